@@ -7,37 +7,39 @@ set -euo pipefail
 
 echo "Inicializando CSVs..."
 
-# Static: Sparse Table
-rm -f construccion-rmq-sparse-table-static.csv
-rm -f consultas-rmq-sparse-table-static.csv
+# Todos los experimentos usan rmq_server (SERVER=./rmq_server-pgo para el
+# binario optimizado con perfil). Cada motor/modo escribe sus propios CSV:
+# <tipo>-rmq-<motor>-<static|dinamic>.csv
+SERVER="${SERVER:-./rmq_server}"
 
-echo "size,rmq_mb,build_ns"  > construccion-rmq-sparse-table-static.csv
-echo "size,range,query_ns"   > consultas-rmq-sparse-table-static.csv
+STATIC_MOTORES=("sdsl-sparse-table" "segment-tree" "cartesian-tree")
+DYNAMIC_MOTORES=("sparse-table" "segment-tree")
 
-# Static: Segment Tree
-rm -f construccion-rmq-segment-tree-static.csv
-rm -f consultas-rmq-segment-tree-static.csv
-
-echo "size,rmq_mb,build_ns"  > construccion-rmq-segment-tree-static.csv
-echo "size,range,query_ns"   > consultas-rmq-segment-tree-static.csv
-
-# Dynamic: Sparse Table
-rm -f construccion-rmq-sparse-table-dinamic.csv
-rm -f consultas-rmq-sparse-table.csv
-rm -f update-rmq-sparse-table-dinamic.csv
-
-echo "size,rmq_mb,build_ns"  > construccion-rmq-sparse-table-dinamic.csv
-echo "size,range,query_ns"   > consultas-rmq-sparse-table.csv
-echo "size,index,value,update_ns" > update-rmq-sparse-table-dinamic.csv
+for motor in "${STATIC_MOTORES[@]}"; do
+    echo "size,rmq_mb,build_ns"  > "construccion-rmq-${motor}-static.csv"
+    echo "size,range,query_ns"   > "consultas-rmq-${motor}-static.csv"
+done
 
-# Dynamic: Segment Tree
-rm -f construccion-rmq-segment-tree-dinamic.csv
-rm -f consultas-rmq-segment-tree.csv
-rm -f update-rmq-segment-tree-dinamic.csv
+for motor in "${DYNAMIC_MOTORES[@]}"; do
+    echo "size,rmq_mb,build_ns"  > "construccion-rmq-${motor}-dinamic.csv"
+    echo "size,range,query_ns"   > "consultas-rmq-${motor}-dinamic.csv"
+    echo "size,index,value,update_ns" > "update-rmq-${motor}-dinamic.csv"
+done
 
-echo "size,rmq_mb,build_ns"  > construccion-rmq-segment-tree-dinamic.csv
-echo "size,range,query_ns"   > consultas-rmq-segment-tree.csv
-echo "size,index,value,update_ns" > update-rmq-segment-tree-dinamic.csv
+# Workload (trazas binarias reproducidas en proceso)
+rm -f workload-rmq.csv
+echo "engine,size,ops,rate,type,count,throughput,p50_ns,p90_ns,p99_ns,p999_ns,max_ns" > workload-rmq.csv
+
+# Consultas extra (top-k, umbral, siguiente menor): un CSV por tipo y motor
+EXTRA_ETIQUETAS=()
+for motor in "${STATIC_MOTORES[@]}"; do EXTRA_ETIQUETAS+=("${motor}-static"); done
+for motor in "${DYNAMIC_MOTORES[@]}"; do EXTRA_ETIQUETAS+=("${motor}-dinamic"); done
+for etiqueta in "${EXTRA_ETIQUETAS[@]}"; do
+    echo "size,range,k,query_ns"         > "topk-rmq-${etiqueta}.csv"
+    echo "size,range,count,query_ns"     > "conteo-rmq-${etiqueta}.csv"
+    echo "size,range,count,query_ns"     > "reporte-rmq-${etiqueta}.csv"
+    echo "size,index,distance,query_ns"  > "siguiente-menor-rmq-${etiqueta}.csv"
+done
 
 echo "CSV listos."
 echo
@@ -48,16 +50,15 @@ echo
 
 echo "Ejecutando experimentos ESTÁTICOS..."
 
-STATIC_BINARIES=("RMQ-Sparse-Table-Static" "RMQ-Segment-Tree-Static")
 SIZES=(1000 2000 3000 4000 5000)
 REPS=30
 
-for bin in "${STATIC_BINARIES[@]}"; do
-    if [[ ! -x "./$bin" ]]; then
-        echo "⚠️  Advertencia: ejecutable ./$bin no existe o no es ejecutable."
-        continue
-    fi
+if [[ ! -x "$SERVER" ]]; then
+    echo "⚠️  Advertencia: ejecutable $SERVER no existe o no es ejecutable (make)."
+    exit 1
+fi
 
+for motor in "${STATIC_MOTORES[@]}"; do
     for n in "${SIZES[@]}"; do
         dataset="dataset_${n}.txt"
         cmds="comandos_static_${n}.txt"
@@ -71,9 +72,27 @@ for bin in "${STATIC_BINARIES[@]}"; do
             continue
         fi
 
-        echo "==> [STATIC] $bin con n=$n (30 repeticiones)..."
+        echo "==> [STATIC] $motor con n=$n (30 repeticiones)..."
         for ((rep=1; rep<=REPS; rep++)); do
-            ./"$bin" "$dataset" < "$cmds" > /dev/null
+            "$SERVER" --motor "$motor" --modo static "$dataset" < "$cmds" > /dev/null
+        done
+    done
+done
+
+# Construcción a n grande: sparse table (n log n) vs árbol cartesiano (lineal).
+# Solo se corre si existen los datasets (python3 generar_datasets_rmq.py 100000 1000000 10000000).
+LARGE_SIZES=(100000 1000000 10000000)
+LARGE_MOTORES=("sdsl-sparse-table" "cartesian-tree")
+LARGE_REPS=5
+
+for motor in "${LARGE_MOTORES[@]}"; do
+    for n in "${LARGE_SIZES[@]}"; do
+        dataset="dataset_${n}.txt"
+        [[ -f "$dataset" ]] || continue
+
+        echo "==> [STATIC-LARGE] $motor con n=$n ($LARGE_REPS repeticiones, solo construcción)..."
+        for ((rep=1; rep<=LARGE_REPS; rep++)); do
+            echo "exit" | "$SERVER" --motor "$motor" --modo static "$dataset" > /dev/null
         done
     done
 done
@@ -87,17 +106,72 @@ echo
 
 echo "Ejecutando experimentos DINÁMICOS..."
 
-DYNAMIC_BINARIES=("RMQ-Sparse-Table-Dinamic" "RMQ-Segment-Tree-Dinamic")
+for motor in "${DYNAMIC_MOTORES[@]}"; do
+    for n in "${SIZES[@]}"; do
+        dataset="dataset_${n}.txt"
+        cmds="comandos_${n}.txt"
+
+        if [[ ! -f "$dataset" ]]; then
+            echo "⚠️  Dataset $dataset no encontrado, se omite."
+            continue
+        fi
+        if [[ ! -f "$cmds" ]]; then
+            echo "⚠️  Archivo de comandos $cmds no encontrado, se omite."
+            continue
+        fi
+
+        echo "==> [DINAMIC] $motor con n=$n (30 repeticiones)..."
+        for ((rep=1; rep<=REPS; rep++)); do
+            "$SERVER" --motor "$motor" --modo dinamic "$dataset" < "$cmds" > /dev/null
+        done
+    done
+done
 
-for bin in "${DYNAMIC_BINARIES[@]}"; do
-    if [[ ! -x "./$bin" ]]; then
-        echo "⚠️  Advertencia: ejecutable ./$bin no existe o no es ejecutable."
-        continue
-    fi
+# ==========================
+# 4) Workload en proceso
+# ==========================
 
+echo
+echo "Ejecutando WORKLOAD (trazas Zipf, 1M operaciones)..."
+
+WORKLOAD_ENGINES=("segment-tree" "sparse-table" "sdsl-sparse-table" "adaptativo"
+                  "block-sparse-table-16" "block-sparse-table-32" "block-sparse-table-64"
+                  "cartesian-tree")
+WORKLOAD_OPS=1000000
+
+if [[ ! -x "./rmq_workload" ]]; then
+    echo "⚠️  Advertencia: ejecutable ./rmq_workload no existe o no es ejecutable."
+else
     for n in "${SIZES[@]}"; do
         dataset="dataset_${n}.txt"
-        cmds="comandos_${n}.txt"
+        traza="traza_${n}.bin"
+
+        if [[ ! -f "$dataset" ]]; then
+            echo "⚠️  Dataset $dataset no encontrado, se omite."
+            continue
+        fi
+
+        ./rmq_workload gen "$traza" "$n" "$WORKLOAD_OPS" --zipf 0.99 --localidad 0.2 > /dev/null
+        for engine in "${WORKLOAD_ENGINES[@]}"; do
+            echo "==> [WORKLOAD] $engine con n=$n..."
+            ./rmq_workload replay "$engine" "$dataset" "$traza" > /dev/null
+        done
+    done
+fi
+
+# ==========================
+# 5) Consultas extra
+# ==========================
+
+echo
+echo "Ejecutando CONSULTAS EXTRA (K, C, R, N)..."
+
+for etiqueta in "${EXTRA_ETIQUETAS[@]}"; do
+    motor="${etiqueta%-*}"
+    modo="${etiqueta##*-}"
+    for n in "${SIZES[@]}"; do
+        dataset="dataset_${n}.txt"
+        cmds="comandos_extra_${n}.txt"
 
         if [[ ! -f "$dataset" ]]; then
             echo "⚠️  Dataset $dataset no encontrado, se omite."
@@ -108,9 +182,9 @@ for bin in "${DYNAMIC_BINARIES[@]}"; do
             continue
         fi
 
-        echo "==> [DINAMIC] $bin con n=$n (30 repeticiones)..."
+        echo "==> [EXTRA] $motor ($modo) con n=$n ($REPS repeticiones)..."
         for ((rep=1; rep<=REPS; rep++)); do
-            ./"$bin" "$dataset" < "$cmds" > /dev/null
+            "$SERVER" --motor "$motor" --modo "$modo" "$dataset" < "$cmds" > /dev/null
         done
     done
 done
@@ -0,0 +1,39 @@
+import random
+
+# Comandos para las consultas extra (top-k, umbral y siguiente menor).
+# Los umbrales se sacan del mismo rango que generar_datasets_rmq.py (0..9999).
+VALOR_MAX = 9999
+
+def generar_comandos_extra_para_n(n, num_queries=100):
+    comandos = []
+    for _ in range(num_queries):
+        l = random.randint(0, n - 1)
+        r = random.randint(l, n - 1)  # aseguramos l <= r
+        tipo = random.choice("KCRN")
+        if tipo == "K":
+            k = random.choice([1, 10, 100, 1000])
+            comandos.append(f"K {l} {r} {k}")
+        elif tipo in "CR":
+            # Umbrales bajos: pocos resultados, que es donde la poda rinde
+            t = random.randint(0, VALOR_MAX // 10)
+            comandos.append(f"{tipo} {l} {r} {t}")
+        else:
+            comandos.append(f"N {l}")
+    return comandos
+
+def main():
+    random.seed(0)  # opcional: para reproducibilidad
+
+    tamanos = [1000, 2000, 3000, 4000, 5000]
+    for n in tamanos:
+        nombre_archivo = f"comandos_extra_{n}.txt"
+        comandos = generar_comandos_extra_para_n(n)
+
+        with open(nombre_archivo, "w") as f:
+            for linea in comandos:
+                f.write(linea + "\n")
+
+        print(f"✅ Archivo '{nombre_archivo}' creado con {len(comandos)} consultas para n={n}.")
+
+if __name__ == "__main__":
+    main()
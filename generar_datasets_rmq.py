@@ -1,4 +1,5 @@
 import random
+import sys
 
 def generar_archivo(nombre, n, minimo=0, maximo=9999):
     """Genera un archivo con n enteros aleatorios entre [minimo, maximo]."""
@@ -9,7 +10,9 @@ def generar_archivo(nombre, n, minimo=0, maximo=9999):
 
 
 def main():
-    tamanos = [1000, 2000, 3000, 4000, 5000]
+    # Tamaños extra por línea de comandos, p.ej. para construcción a n grande:
+    #   python3 generar_datasets_rmq.py 100000 1000000 10000000
+    tamanos = [int(a) for a in sys.argv[1:]] or [1000, 2000, 3000, 4000, 5000]
     for n in tamanos:
         nombre = f"dataset_{n}.txt"
         generar_archivo(nombre, n)
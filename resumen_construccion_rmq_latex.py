@@ -1,14 +1,16 @@
 #!/usr/bin/env python3
 import csv
+import os
 from collections import defaultdict
 from statistics import mean, stdev
 
 # Archivos de entrada: modelo -> archivo
 FILES = {
-    "ST-Static":  "construccion-rmq-sparse-table-static.csv",
+    "ST-Static":  "construccion-rmq-sdsl-sparse-table-static.csv",
     "ST-Dynamic": "construccion-rmq-sparse-table-dinamic.csv",
     "Seg-Static": "construccion-rmq-segment-tree-static.csv",
     "Seg-Dynamic":"construccion-rmq-segment-tree-dinamic.csv",
+    "Cart-Static":"construccion-rmq-cartesian-tree-static.csv",
 }
 
 def leer_datos_construccion(filename):
@@ -19,6 +21,8 @@ def leer_datos_construccion(filename):
         dict[size] -> lista de (rmq_mb, build_ns)
     """
     datos = defaultdict(list)
+    if not os.path.exists(filename):
+        return datos
     with open(filename, newline="") as f:
         reader = csv.reader(f)
         header = next(reader, None)  # saltar cabecera
@@ -68,7 +72,7 @@ def tabla_memoria_latex(resumen):
       - filas: tamaño del arreglo
       - columnas: memoria promedio (MB) de cada modelo
     """
-    modelos = ["ST-Static", "ST-Dynamic", "Seg-Static", "Seg-Dynamic"]
+    modelos = list(FILES)
     sizes = todas_las_sizes(resumen)
 
     lines = []
@@ -77,9 +81,9 @@ def tabla_memoria_latex(resumen):
     lines.append(r"\caption{Memoria promedio utilizada por cada estructura RMQ (en MB).}")
     lines.append(r"\renewcommand{\arraystretch}{1.2}")
     lines.append(r"\setlength{\tabcolsep}{6pt}")
-    lines.append(r"\begin{tabular}{rcccc}")
+    lines.append(r"\begin{tabular}{r" + "c" * len(modelos) + "}")
     lines.append(r"\toprule")
-    lines.append(r"\textbf{Tamaño} & \textbf{ST-Static} & \textbf{ST-Dynamic} & \textbf{Seg-Static} & \textbf{Seg-Dynamic}\\")
+    lines.append(" & ".join([r"\textbf{Tamaño}"] + [rf"\textbf{{{m}}}" for m in modelos]) + r"\\")
     lines.append(r"\midrule")
 
     for size in sizes:
@@ -102,7 +106,7 @@ def tabla_tiempos_latex(resumen):
       - filas: tamaño del arreglo
       - por cada modelo: 2 columnas (promedio, desviación estándar)
     """
-    modelos = ["ST-Static", "ST-Dynamic", "Seg-Static", "Seg-Dynamic"]
+    modelos = list(FILES)
     sizes = todas_las_sizes(resumen)
 
     lines = []
@@ -111,14 +115,14 @@ def tabla_tiempos_latex(resumen):
     lines.append(r"\caption{Tiempo de construcción promedio y desviación estándar (ns) para cada estructura RMQ.}")
     lines.append(r"\renewcommand{\arraystretch}{1.2}")
     lines.append(r"\setlength{\tabcolsep}{4pt}")
-    # 1 columna para tamaño + 2 por modelo = 1 + 8 = 9 columnas
-    lines.append(r"\begin{tabular}{rcccccccc}")
+    # 1 columna para tamaño + 2 por modelo
+    lines.append(r"\begin{tabular}{r" + "cc" * len(modelos) + "}")
     lines.append(r"\toprule")
     header1 = [r"\multirow{2}{*}{\textbf{Tamaño}}"]
     for modelo in modelos:
         header1.append(rf"\multicolumn{{2}}{{c}}{{\textbf{{{modelo}}}}}")
     lines.append(" & ".join(header1) + r"\\")
-    lines.append(r"\cmidrule(lr){2-3}\cmidrule(lr){4-5}\cmidrule(lr){6-7}\cmidrule(lr){8-9}")
+    lines.append("".join(rf"\cmidrule(lr){{{2 + 2 * k}-{3 + 2 * k}}}" for k in range(len(modelos))))
     header2 = [""]
     for _ in modelos:
         header2.append(r"\textbf{Prom.}")
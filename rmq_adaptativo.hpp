@@ -0,0 +1,237 @@
+// rmq_adaptativo.hpp
+// Motor RMQ compuesto: mantiene varias estructuras sobre el mismo int_vector<>
+// y decide cuál usar en cada consulta según el largo del rango y la tasa
+// reciente de updates.
+//
+//  - scan lineal: sin estructura, gana en rangos muy cortos.
+//  - sparse table: O(1) por consulta, pero un update la deja obsoleta y
+//    reconstruirla cuesta O(n log n).
+//  - segment tree: O(log n) por consulta, se mantiene al día con cada update.
+//
+// calibrar() corre un microbenchmark corto al construir y arma una tabla
+// largo -> motor por potencia de 2. Si la sparse table está obsoleta, se
+// reconstruye solo cuando las consultas esperadas hasta el próximo update
+// amortizan el costo medido de reconstrucción; si no, se usa la mejor
+// alternativa (scan o segment tree) para ese largo.
+#ifndef RMQ_ADAPTATIVO_HPP
+#define RMQ_ADAPTATIVO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <ostream>
+#include <random>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/bits.hpp>
+
+#include "rmq_segment_tree.hpp"
+#include "rmq_sparse_table.hpp"
+
+struct rmq_adaptativo {
+    enum motor { SCAN = 0, SPARSE = 1, SEGMENT = 2, NUM_MOTORES = 3 };
+    static const int NUM_CUBETAS = 64;  // cubeta b: largos en [2^b, 2^(b+1))
+
+    const sdsl::int_vector<>* A;
+    rmq_sparse_table sparse;
+    rmq_segment_tree segment;
+    bool sparse_obsoleta;
+
+    // Resultado de la calibración
+    uint8_t eleccion[NUM_CUBETAS];           // motor a usar si la sparse está al día
+    uint8_t eleccion_sin_sparse[NUM_CUBETAS];
+    double costo_ns[NUM_MOTORES][NUM_CUBETAS];  // < 0: no medido
+    double rebuild_ns;
+
+    // Tasa reciente de updates: media móvil exponencial de (op == update)
+    double tasa_updates;
+
+    // Estadísticas
+    uint64_t consultas[NUM_MOTORES];
+    uint64_t updates;
+    uint64_t rebuilds;
+
+    rmq_adaptativo() : A(nullptr), sparse_obsoleta(false), rebuild_ns(0),
+                       tasa_updates(0), updates(0), rebuilds(0) {
+        for (int m = 0; m < NUM_MOTORES; ++m) consultas[m] = 0;
+    }
+
+    rmq_adaptativo(const sdsl::int_vector<>* a) : rmq_adaptativo() {
+        build(a);
+    }
+
+    void build(const sdsl::int_vector<>* a) {
+        A = a;
+        sparse.build(a);
+        segment.build(a);
+        sparse_obsoleta = false;
+        calibrar();
+    }
+
+    // Índice del mínimo en [l, r] (empate: menor índice)
+    uint64_t operator()(size_t l, size_t r) {
+        tasa_updates -= tasa_updates * ALFA;
+        int m = elegir(r - l + 1);
+        ++consultas[m];
+        return consultar(m, l, r);
+    }
+
+    // Update: A[i] ya fue escrito afuera
+    void update(size_t i) {
+        tasa_updates += (1.0 - tasa_updates) * ALFA;
+        ++updates;
+        segment.update(i);
+        sparse_obsoleta = true;
+    }
+
+    size_t bytes() const {
+        return sparse.bytes() + segment.bytes();
+    }
+
+    static const char* nombre(int m) {
+        static const char* nombres[NUM_MOTORES] = {"scan", "sparse-table", "segment-tree"};
+        return nombres[m];
+    }
+
+    void stats(std::ostream& out) const {
+        size_t n = A ? A->size() : 0;
+        out << "rmq_adaptativo: n=" << n << ", rebuild sparse ~" << rebuild_ns << " ns\n";
+        out << "  largo           motor (al día / obsoleta)   scan_ns  sparse_ns  segment_ns\n";
+        for (int b = 0; b < NUM_CUBETAS && (1ULL << b) <= n; ++b) {
+            out << "  [2^" << b << ", 2^" << (b + 1) << ")\t"
+                << nombre(eleccion[b]) << " / " << nombre(eleccion_sin_sparse[b]);
+            for (int m = 0; m < NUM_MOTORES; ++m) {
+                out << "\t";
+                if (costo_ns[m][b] < 0) out << "-";
+                else out << costo_ns[m][b];
+            }
+            out << "\n";
+        }
+        out << "  consultas: scan " << consultas[SCAN] << ", sparse-table " << consultas[SPARSE]
+            << ", segment-tree " << consultas[SEGMENT] << "\n";
+        out << "  updates " << updates << ", rebuilds sparse " << rebuilds
+            << ", tasa reciente de updates " << tasa_updates << "\n";
+    }
+
+    // ---- internos ----
+
+    static constexpr double ALFA = 1.0 / 64;   // peso de la media móvil
+    static const int REPS_CALIBRACION = 256;
+    static const int RONDAS_CALIBRACION = 5;  // se queda con la mínima
+
+    static int cubeta(size_t largo) {
+        return static_cast<int>(sdsl::bits::hi(largo));
+    }
+
+    int elegir(size_t largo) {
+        int b = cubeta(largo);
+        int m = eleccion[b];
+        if (m != SPARSE || !sparse_obsoleta) return m;
+
+        int alt = eleccion_sin_sparse[b];
+        // Consultas esperadas antes del próximo update ~ (1 - u) / u
+        double u = tasa_updates;
+        double esperadas = u > 0 ? (1.0 - u) / u : 1e18;
+        double ganancia = costo_ns[alt][b] - costo_ns[SPARSE][b];
+        if (esperadas * ganancia > rebuild_ns) {
+            sparse.rebuild();
+            sparse_obsoleta = false;
+            ++rebuilds;
+            return SPARSE;
+        }
+        return alt;
+    }
+
+    uint64_t consultar(int m, size_t l, size_t r) const {
+        switch (m) {
+            case SCAN: return scan(l, r);
+            case SPARSE: return sparse(l, r);
+            default: return segment(l, r);
+        }
+    }
+
+    uint64_t scan(size_t l, size_t r) const {
+        const sdsl::int_vector<>& a = *A;
+        size_t mejor = l;
+        uint64_t v = a[l];
+        for (size_t i = l + 1; i <= r; ++i) {
+            uint64_t x = a[i];
+            if (x < v) {
+                v = x;
+                mejor = i;
+            }
+        }
+        return mejor;
+    }
+
+    // Microbenchmark: para cada potencia de 2 mide cada motor sobre rangos
+    // aleatorios de ese largo. Cada medición se repite RONDAS_CALIBRACION
+    // veces rotando el orden de los motores y se guarda la mínima, así
+    // ninguno queda siempre primero con el cache frío. El scan deja de
+    // medirse cuando ya es mucho más lento que el segment tree, para que la
+    // calibración siga siendo corta con n grande.
+    void calibrar() {
+        size_t n = A->size();
+        for (int b = 0; b < NUM_CUBETAS; ++b) {
+            eleccion[b] = eleccion_sin_sparse[b] = SEGMENT;
+            for (int m = 0; m < NUM_MOTORES; ++m) costo_ns[m][b] = -1;
+        }
+        if (n == 0) return;
+
+        {
+            auto t0 = std::chrono::steady_clock::now();
+            sparse.rebuild();
+            auto t1 = std::chrono::steady_clock::now();
+            rebuild_ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        }
+
+        std::mt19937_64 rng(12345);
+        size_t ls[REPS_CALIBRACION];
+        bool medir_scan = true;
+        volatile uint64_t sumidero = 0;
+
+        for (int b = 0; b < NUM_CUBETAS && (1ULL << b) <= n; ++b) {
+            size_t largo = static_cast<size_t>(1) << b;
+            std::uniform_int_distribution<size_t> pos(0, n - largo);
+            for (int k = 0; k < REPS_CALIBRACION; ++k) ls[k] = pos(rng);
+
+            for (int ronda = 0; ronda < RONDAS_CALIBRACION; ++ronda) {
+                for (int j = 0; j < NUM_MOTORES; ++j) {
+                    int m = (ronda + j) % NUM_MOTORES;
+                    if (m == SCAN && !medir_scan) continue;
+                    uint64_t acc = 0;
+                    auto t0 = std::chrono::steady_clock::now();
+                    for (int k = 0; k < REPS_CALIBRACION; ++k) {
+                        acc += consultar(m, ls[k], ls[k] + largo - 1);
+                    }
+                    auto t1 = std::chrono::steady_clock::now();
+                    sumidero = sumidero + acc;
+                    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count()
+                                / REPS_CALIBRACION;
+                    if (costo_ns[m][b] < 0 || ns < costo_ns[m][b]) costo_ns[m][b] = ns;
+                }
+            }
+
+            eleccion[b] = mas_barato(b, true);
+            eleccion_sin_sparse[b] = mas_barato(b, false);
+
+            // El scan compite con el segment tree cuando la sparse está
+            // obsoleta, así que se compara contra esa alternativa
+            double alternativa = costo_ns[SEGMENT][b];
+            if (medir_scan && costo_ns[SCAN][b] > 8 * alternativa) medir_scan = false;
+        }
+        (void)sumidero;
+    }
+
+    uint8_t mas_barato(int b, bool con_sparse) const {
+        int mejor = SEGMENT;
+        for (int m = 0; m < NUM_MOTORES; ++m) {
+            if (m == SPARSE && !con_sparse) continue;
+            if (costo_ns[m][b] < 0) continue;
+            if (costo_ns[m][b] < costo_ns[mejor][b]) mejor = m;
+        }
+        return static_cast<uint8_t>(mejor);
+    }
+};
+
+#endif // RMQ_ADAPTATIVO_HPP
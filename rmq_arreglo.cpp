@@ -0,0 +1,105 @@
+// rmq_arreglo.cpp
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+
+#include <sdsl/bits.hpp>
+
+#include "rmq_arreglo.hpp"
+#include "rmq_huge_pages.hpp"
+
+using namespace std;
+using namespace sdsl;
+
+// Ancho suficiente para los datos y para los valores que escriben los updates
+static uint8_t ancho_para(uint64_t maximo) {
+    uint8_t w = static_cast<uint8_t>(bits::hi(maximo) + 1);
+    return w == 0 ? 1 : w;
+}
+
+// Bytes que SDSL reserva para n valores de w bits: palabras de 64 bits más
+// una de relleno (ver memory_manager::resize)
+static size_t bytes_int_vector(size_t n, uint8_t w) {
+    return ((static_cast<uint64_t>(n) * w + 64) >> 6) << 3;
+}
+
+// Crea A respetando RMQ_HUGEPAGES (pool de SDSL en hugetlb, madvise en thp).
+// Sin pool, A se dimensiona con resize() (que no escribe los datos) y se
+// aconseja THP antes de tocarlo: si se llenara primero, cada página ya
+// quedaría mapeada en 4 KB hasta que khugepaged la compacte. Los valores los
+// escribe después quien llama. Devuelve false si no se pudo reservar.
+static bool crear_arreglo(int_vector<>& A, size_t n, uint8_t w, bool pool_hugetlb) {
+    bool en_pool = false;
+    if (pool_hugetlb) {
+        // Margen para los encabezados de bloque del allocator de SDSL
+        en_pool = rmq_preparar_arreglo_huge(bytes_int_vector(n, w) + 4096);
+    } else if (rmq_modo_paginas_actual() == PAGINAS_HUGETLB) {
+        cerr << "Advertencia: el pool hugetlb de SDSL solo alcanza para A y este motor "
+             << "crea int_vector<> propios; A usa THP.\n";
+    }
+    try {
+        if (en_pool || rmq_modo_paginas_actual() == PAGINAS_NORMALES) {
+            A = int_vector<>(n, 0, w);
+        } else {
+            A = int_vector<>(0, 0, w);
+            A.resize(n);
+            rmq_aconsejar_thp(A.data(), bytes_int_vector(n, w));
+        }
+    } catch (const exception& e) {
+        cerr << "Error: no se pudo reservar el arreglo de " << n << " elementos ("
+             << e.what() << ").\n";
+        return false;
+    }
+    return true;
+}
+
+bool rmq_cargar_arreglo(const char* ruta, uint64_t vmax, int_vector<>& A, bool pool_hugetlb) {
+    if (strncmp(ruta, "aleatorio:", 10) == 0) {
+        uint64_t n = strtoull(ruta + 10, nullptr, 10);
+        if (n == 0) {
+            cerr << "Error: tamaño inválido en " << ruta << "\n";
+            return false;
+        }
+        if (!crear_arreglo(A, n, ancho_para(vmax), pool_hugetlb)) return false;
+        mt19937_64 rng(42);
+        uniform_int_distribution<uint64_t> valor(0, vmax);
+        for (size_t i = 0; i < n; ++i) {
+            A[i] = valor(rng);
+        }
+        return true;
+    }
+
+    ifstream in(ruta);
+    if (!in) {
+        cerr << "Error: no se pudo abrir el archivo " << ruta << "\n";
+        return false;
+    }
+    vector<uint64_t> tmp;
+    long long x;
+    while (in >> x) {
+        tmp.push_back(static_cast<uint64_t>(x));
+    }
+    if (tmp.empty()) {
+        cerr << "Error: el archivo no contiene enteros válidos.\n";
+        return false;
+    }
+
+    uint64_t maximo = vmax;
+    for (size_t i = 0; i < tmp.size(); ++i) maximo = max(maximo, tmp[i]);
+
+    if (!crear_arreglo(A, tmp.size(), ancho_para(maximo), pool_hugetlb)) return false;
+    for (size_t i = 0; i < tmp.size(); ++i) {
+        A[i] = tmp[i];
+    }
+    return true;
+}
+
+uint64_t rmq_valor_maximo(const int_vector<>& A) {
+    uint8_t w = A.width();
+    return w >= 64 ? ~0ULL : (1ULL << w) - 1;
+}
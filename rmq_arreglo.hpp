@@ -0,0 +1,26 @@
+// rmq_arreglo.hpp
+// Carga del arreglo A para rmq_server y rmq_workload (antes cada binario
+// tenía su propia copia de la lectura y el bit_compress).
+#ifndef RMQ_ARREGLO_HPP
+#define RMQ_ARREGLO_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sdsl/int_vector.hpp>
+
+// Carga A desde un archivo de enteros separados por espacios o saltos de
+// línea, o genera N valores uniformes en [0, vmax] si ruta = "aleatorio:N"
+// (sin pasar por un archivo de texto, útil para n ~ 10^9).
+// El ancho de A alcanza para los datos y para cualquier valor <= vmax, así
+// los updates posteriores no se truncan. Respeta RMQ_HUGEPAGES; con hugetlb,
+// A va al pool de SDSL solo si pool_hugetlb (el motor no crea int_vector<>
+// propios, ver motor_rmq::crea_int_vectors), si no usa THP.
+// Si falla escribe el motivo en stderr y devuelve false.
+bool rmq_cargar_arreglo(const char* ruta, uint64_t vmax, sdsl::int_vector<>& A,
+                        bool pool_hugetlb);
+
+// Mayor valor que cabe en A (según su ancho)
+uint64_t rmq_valor_maximo(const sdsl::int_vector<>& A);
+
+#endif // RMQ_ARREGLO_HPP
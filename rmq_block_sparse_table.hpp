@@ -0,0 +1,126 @@
+// rmq_block_sparse_table.hpp
+// Sparse table en dos niveles: el arreglo se divide en bloques de t_b
+// elementos, la sparse table se construye solo sobre los mínimos de cada
+// bloque y dentro del bloque se responde con una máscara de bits por
+// posición (la pila de mínimos del prefijo del bloque).
+//
+// mask[i] tiene el bit j encendido si la posición inicio_bloque + j (<= i)
+// está en la pila de mínimos al llegar a i, es decir, si A[j] <= A[k] para
+// todo k en (j, i]. El mínimo de [l, r] dentro de un bloque es entonces el
+// bit encendido más bajo de mask[r] a partir de l (empate: menor índice).
+//
+// Consultas O(1) con ~n palabras de t_b bits + (n / t_b) log(n / t_b) índices,
+// en vez de n log n de la sparse table completa. t_b (1..64) se fija al
+// compilar: bloques más chicos usan máscaras más angostas pero una sparse
+// table más grande.
+#ifndef RMQ_BLOCK_SPARSE_TABLE_HPP
+#define RMQ_BLOCK_SPARSE_TABLE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/bits.hpp>
+
+#include "rmq_sparse_table.hpp"
+
+template <uint32_t t_b = 64>
+struct rmq_block_sparse_table {
+    static_assert(t_b >= 1 && t_b <= 64, "el bloque debe tener entre 1 y 64 elementos");
+
+    // Palabra más angosta que alcanza para t_b bits
+    typedef typename std::conditional<(t_b <= 8), uint8_t,
+            typename std::conditional<(t_b <= 16), uint16_t,
+            typename std::conditional<(t_b <= 32), uint32_t, uint64_t>::type>::type>::type mask_t;
+
+    const sdsl::int_vector<>* A;  // puntero al arreglo original
+    std::vector<mask_t> mask;     // una máscara por posición
+    sdsl::int_vector<> minimos;   // valor mínimo de cada bloque
+    sdsl::int_vector<> pos_min;   // posición en A del mínimo de cada bloque
+    rmq_sparse_table st;          // sparse table sobre minimos
+
+    rmq_block_sparse_table() : A(nullptr) {}
+
+    rmq_block_sparse_table(const sdsl::int_vector<>* a) {
+        build(a);
+    }
+
+    void build(const sdsl::int_vector<>* a) {
+        A = a;
+        size_t n = A->size();
+        size_t nb = (n + t_b - 1) / t_b;
+        mask.assign(n, 0);
+        minimos = sdsl::int_vector<>(nb, 0, A->width());
+        pos_min = sdsl::int_vector<>(nb, 0, n > 1 ? sdsl::bits::hi(n - 1) + 1 : 1);
+        for (size_t b = 0; b < nb; ++b) {
+            build_bloque(b);
+        }
+        st.build(&minimos);
+    }
+
+    // Recalcula las máscaras y el mínimo del bloque b
+    void build_bloque(size_t b) {
+        const sdsl::int_vector<>& a = *A;
+        size_t ini = b * t_b;
+        size_t fin = ini + t_b < a.size() ? ini + t_b : a.size();
+        uint64_t m = 0;
+        for (size_t i = ini; i < fin; ++i) {
+            uint64_t v = a[i];
+            // Sacar de la pila (bits altos) los mayores estrictos que A[i]
+            while (m != 0 && a[ini + sdsl::bits::hi(m)] > v) {
+                m &= ~(1ULL << sdsl::bits::hi(m));
+            }
+            m |= 1ULL << (i - ini);
+            mask[i] = static_cast<mask_t>(m);
+        }
+        // El fondo de la pila al final del bloque es su mínimo
+        size_t p = ini + sdsl::bits::lo(m);
+        pos_min[b] = p;
+        minimos[b] = a[p];
+    }
+
+    // Mínimo de [l, r] con l y r en el mismo bloque
+    uint64_t en_bloque(size_t l, size_t r) const {
+        size_t ini = l - l % t_b;
+        uint64_t m = static_cast<uint64_t>(mask[r]) & (~0ULL << (l - ini));
+        return ini + sdsl::bits::lo(m);
+    }
+
+    // Índice del mínimo en [l, r] (empate: menor índice)
+    uint64_t operator()(size_t l, size_t r) const {
+        size_t bl = l / t_b;
+        size_t br = r / t_b;
+        if (bl == br) return en_bloque(l, r);
+
+        const sdsl::int_vector<>& a = *A;
+        uint64_t mejor = en_bloque(l, bl * t_b + t_b - 1);
+        if (br > bl + 1) {
+            uint64_t c = pos_min[st(bl + 1, br - 1)];
+            if (a[c] < a[mejor]) mejor = c;
+        }
+        uint64_t c = en_bloque(br * t_b, r);
+        if (a[c] < a[mejor]) mejor = c;
+        return mejor;
+    }
+
+    // Update: A[i] ya fue escrito afuera. Rehace el bloque de i (O(t_b)) y la
+    // sparse table sobre los mínimos, que es n / t_b veces más chica.
+    void update(size_t i) {
+        size_t b = i / t_b;
+        uint64_t antes = pos_min[b];
+        uint64_t v_antes = minimos[b];
+        build_bloque(b);
+        if (pos_min[b] != antes || minimos[b] != v_antes) {
+            st.rebuild();
+        }
+    }
+
+    size_t bytes() const {
+        return sizeof(*this) + mask.size() * sizeof(mask_t) +
+               sdsl::size_in_bytes(minimos) + sdsl::size_in_bytes(pos_min) + st.bytes();
+    }
+};
+
+#endif // RMQ_BLOCK_SPARSE_TABLE_HPP
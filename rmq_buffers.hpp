@@ -0,0 +1,264 @@
+// rmq_buffers.hpp
+// Buffers preasignados para el loop de comandos de los experimentos RMQ.
+// La idea es que, una vez construida la estructura, procesar un comando
+// (leer la línea, parsearla, responder y escribir en los CSV) no haga
+// ninguna asignación en el heap: todo se hace sobre arreglos fijos y con
+// llamadas read()/write() directas, sin std::string, stringstream ni ofstream.
+#ifndef RMQ_BUFFERS_HPP
+#define RMQ_BUFFERS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <climits>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+// Buffer de salida de tamaño fijo asociado a un descriptor de archivo.
+// Si el descriptor es -1 la salida se descarta (por ejemplo, si no se pudo
+// abrir un CSV).
+struct buffer_salida {
+    static const size_t CAPACIDAD = 1 << 16;
+
+    int fd;
+    size_t usado;
+    char datos[CAPACIDAD];
+
+    buffer_salida() : fd(-1), usado(0) {}
+
+    explicit buffer_salida(int f) : fd(f), usado(0) {}
+
+    // Vacía y cierra el archivo si lo abrió (stdin/stdout/stderr quedan abiertos)
+    ~buffer_salida() {
+        cerrar();
+    }
+
+    // Abre un archivo en modo append (equivalente a ofstream(..., ios::app))
+    bool abrir_append(const char* ruta) {
+        fd = ::open(ruta, O_WRONLY | O_CREAT | O_APPEND, 0644);
+        return fd != -1;
+    }
+
+    void cerrar() {
+        vaciar();
+        if (fd > 2) ::close(fd);
+        fd = -1;
+    }
+
+    void vaciar() {
+        size_t escrito = 0;
+        while (fd != -1 && escrito < usado) {
+            ssize_t k = ::write(fd, datos + escrito, usado - escrito);
+            if (k < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            escrito += static_cast<size_t>(k);
+        }
+        usado = 0;
+    }
+
+    void reservar(size_t k) {
+        if (usado + k > CAPACIDAD) vaciar();
+    }
+
+    buffer_salida& bytes(const char* s, size_t k) {
+        if (k > CAPACIDAD) k = CAPACIDAD;
+        reservar(k);
+        memcpy(datos + usado, s, k);
+        usado += k;
+        return *this;
+    }
+
+    buffer_salida& texto(const char* s) {
+        return bytes(s, strlen(s));
+    }
+
+    buffer_salida& caracter(char c) {
+        reservar(1);
+        datos[usado++] = c;
+        return *this;
+    }
+
+    buffer_salida& sin_signo(uint64_t v) {
+        char tmp[20];
+        size_t k = 0;
+        do {
+            tmp[k++] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        } while (v != 0);
+        reservar(k);
+        while (k > 0) datos[usado++] = tmp[--k];
+        return *this;
+    }
+
+    buffer_salida& entero(long long v) {
+        if (v < 0) {
+            caracter('-');
+            return sin_signo(0ULL - static_cast<uint64_t>(v));
+        }
+        return sin_signo(static_cast<uint64_t>(v));
+    }
+};
+
+// Lector de líneas sobre un descriptor (stdin por defecto) con buffer fijo.
+// Antes de bloquearse esperando más entrada vacía el buffer de salida
+// asociado, para que el prompt "> " aparezca en modo interactivo.
+struct lector_lineas {
+    static const size_t CAPACIDAD = 1 << 16;
+
+    int fd;
+    buffer_salida* salida;
+    size_t ini, fin;
+    bool eof;
+    char datos[CAPACIDAD];
+
+    lector_lineas(int f, buffer_salida* out)
+        : fd(f), salida(out), ini(0), fin(0), eof(false) {}
+
+    // Entrega la siguiente línea (sin '\n' ni '\r') apuntando dentro del
+    // buffer interno; es válida hasta la siguiente llamada.
+    // Líneas más largas que el buffer se entregan truncadas.
+    bool siguiente(const char*& linea, size_t& largo) {
+        while (true) {
+            char* inicio = datos + ini;
+            char* nl = static_cast<char*>(memchr(inicio, '\n', fin - ini));
+            if (nl != nullptr) {
+                linea = inicio;
+                largo = static_cast<size_t>(nl - inicio);
+                ini += largo + 1;
+                recortar_cr(linea, largo);
+                return true;
+            }
+            if (eof) {
+                if (ini == fin) return false;
+                linea = inicio;
+                largo = fin - ini;
+                ini = fin;
+                recortar_cr(linea, largo);
+                return true;
+            }
+            // Compactar lo pendiente al inicio y pedir más datos
+            if (ini > 0) {
+                memmove(datos, datos + ini, fin - ini);
+                fin -= ini;
+                ini = 0;
+            }
+            if (fin == CAPACIDAD) {
+                linea = datos;
+                largo = fin;
+                ini = fin = 0;
+                return true;
+            }
+            if (salida) salida->vaciar();
+            ssize_t k = ::read(fd, datos + fin, CAPACIDAD - fin);
+            if (k < 0 && errno == EINTR) continue;
+            if (k <= 0) {
+                eof = true;
+            } else {
+                fin += static_cast<size_t>(k);
+            }
+        }
+    }
+
+    static void recortar_cr(const char* linea, size_t& largo) {
+        if (largo > 0 && linea[largo - 1] == '\r') --largo;
+    }
+};
+
+// ---- Parseo sin asignaciones sobre [p, fin) ----
+
+inline void saltar_espacios(const char*& p, const char* fin) {
+    while (p < fin && (*p == ' ' || *p == '\t')) ++p;
+}
+
+// Falla si no hay dígitos o si el número no cabe en 64 bits (como >> de
+// stringstream, en vez de dar la vuelta y ejecutar otro comando)
+inline bool leer_sin_signo(const char*& p, const char* fin, uint64_t& v) {
+    saltar_espacios(p, fin);
+    if (p == fin || *p < '0' || *p > '9') return false;
+    uint64_t x = 0;
+    while (p < fin && *p >= '0' && *p <= '9') {
+        uint64_t d = static_cast<uint64_t>(*p - '0');
+        if (x > (UINT64_MAX - d) / 10) return false;
+        x = x * 10 + d;
+        ++p;
+    }
+    v = x;
+    return true;
+}
+
+inline bool leer_entero(const char*& p, const char* fin, long long& v) {
+    saltar_espacios(p, fin);
+    bool negativo = false;
+    if (p < fin && (*p == '-' || *p == '+')) {
+        negativo = (*p == '-');
+        ++p;
+    }
+    uint64_t x;
+    if (!leer_sin_signo(p, fin, x)) return false;
+    // |LLONG_MIN| = LLONG_MAX + 1 solo vale con signo negativo
+    const uint64_t limite = static_cast<uint64_t>(LLONG_MAX) + (negativo ? 1 : 0);
+    if (x > limite) return false;
+    if (!negativo) {
+        v = static_cast<long long>(x);
+    } else if (x == static_cast<uint64_t>(LLONG_MAX) + 1) {
+        v = LLONG_MIN;
+    } else {
+        v = -static_cast<long long>(x);
+    }
+    return true;
+}
+
+inline bool es_exit(const char* linea, size_t largo) {
+    return largo == 4 &&
+           (memcmp(linea, "exit", 4) == 0 ||
+            memcmp(linea, "EXIT", 4) == 0 ||
+            memcmp(linea, "Exit", 4) == 0);
+}
+
+// ---- Conteo de asignaciones (solo con -DRMQ_CONTAR_ALLOC) ----
+//
+// rmq_contar_alloc.cpp reemplaza el operator new global y cuenta cuántas
+// asignaciones ocurren durante cada comando. Tras RMQ_ALLOC_WARMUP comandos de
+// calentamiento cualquier asignación cuenta como falla y el programa termina
+// con código 1. Todo librmq debe compilarse con el mismo -DRMQ_CONTAR_ALLOC.
+
+#ifndef RMQ_ALLOC_WARMUP
+#define RMQ_ALLOC_WARMUP 8
+#endif
+
+#ifdef RMQ_CONTAR_ALLOC
+extern size_t rmq_alloc_contador;
+#endif
+
+struct control_alloc {
+    size_t comandos;
+    size_t antes;
+    size_t fallas;  // asignaciones tras el calentamiento
+
+    control_alloc() : comandos(0), antes(0), fallas(0) {}
+
+#ifdef RMQ_CONTAR_ALLOC
+    void inicio() { antes = rmq_alloc_contador; }
+    void fin() {
+        if (comandos >= RMQ_ALLOC_WARMUP) fallas += rmq_alloc_contador - antes;
+        ++comandos;
+    }
+    // Devuelve el código de salida: 0 si no hubo asignaciones en régimen
+    int reporte() const {
+        fprintf(stderr, "Asignaciones tras calentamiento (%zu comandos, warmup %d): %zu\n",
+                comandos, RMQ_ALLOC_WARMUP, fallas);
+        return fallas == 0 ? 0 : 1;
+    }
+#else
+    void inicio() {}
+    void fin() {}
+    int reporte() const { return 0; }
+#endif
+};
+
+#endif // RMQ_BUFFERS_HPP
@@ -0,0 +1,251 @@
+// rmq_cartesian_tree.hpp
+// RMQ estático vía LCA: se construye el árbol cartesiano de A en tiempo
+// lineal con una pila, se recorre con un Euler tour y el mínimo de [l, r] es
+// el LCA de l y r, que se obtiene con un RMQ ±1 sobre las profundidades del
+// tour (bloques de ~log(n)/2 pasos + tabla por tipo de bloque + sparse table
+// sobre los mínimos de bloque). Construcción O(n), consulta O(1).
+//
+// El árbol queda expuesto (padre, izq, der; NULO si no hay nodo) para
+// reutilizarlo en otros cálculos sobre el árbol. Los nodos son las posiciones
+// de A y la raíz es la posición del mínimo global (empate: menor índice).
+#ifndef RMQ_CARTESIAN_TREE_HPP
+#define RMQ_CARTESIAN_TREE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/bits.hpp>
+
+#include "rmq_sparse_table.hpp"
+
+struct rmq_cartesian_tree {
+    const sdsl::int_vector<>* A;  // puntero al arreglo original
+    uint64_t NULO;                // = n, marca "sin nodo"
+    uint64_t raiz;
+
+    // Árbol cartesiano
+    sdsl::int_vector<> padre;
+    sdsl::int_vector<> izq;
+    sdsl::int_vector<> der;
+
+    // Euler tour: nodo visitado en cada paso y primera aparición de cada nodo
+    sdsl::int_vector<> euler;
+    sdsl::int_vector<> primera;
+
+    // RMQ ±1 sobre las profundidades del tour
+    uint32_t b;                     // pasos por bloque
+    sdsl::int_vector<> tipo;        // bit s = 1 si la profundidad sube entre s y s+1
+    sdsl::int_vector<> prof_ini;    // profundidad al inicio de cada bloque
+    sdsl::int_vector<> min_bloque;  // profundidad mínima de cada bloque
+    rmq_sparse_table st;            // sparse table sobre min_bloque
+    std::vector<uint8_t> tabla;     // tabla[(t * b + i) * b + j] = offset del mínimo
+
+    rmq_cartesian_tree() : A(nullptr), NULO(0), raiz(0), b(2) {}
+
+    rmq_cartesian_tree(const sdsl::int_vector<>* a) {
+        build(a);
+    }
+
+    void build(const sdsl::int_vector<>* a) {
+        A = a;
+        size_t n = A->size();
+        NULO = n;
+        uint8_t w = static_cast<uint8_t>(sdsl::bits::hi(n) + 1);
+        padre = sdsl::int_vector<>(n, NULO, w);
+        izq = sdsl::int_vector<>(n, NULO, w);
+        der = sdsl::int_vector<>(n, NULO, w);
+        if (n == 0) {
+            raiz = NULO;
+            return;
+        }
+        build_arbol();
+        build_euler(w);
+        build_pm1();
+    }
+
+    // Índice del mínimo en [l, r] (empate: menor índice)
+    uint64_t operator()(size_t l, size_t r) const {
+        if (l == r) return l;
+        uint64_t i = primera[l];
+        uint64_t j = primera[r];
+        if (i > j) {
+            uint64_t t = i;
+            i = j;
+            j = t;
+        }
+        return euler[rmq_pm1(i, j)];
+    }
+
+    // Estructura estática: un update reconstruye todo en O(n)
+    void rebuild() {
+        build(A);
+    }
+
+    size_t bytes() const {
+        return sizeof(*this) +
+               sdsl::size_in_bytes(padre) + sdsl::size_in_bytes(izq) + sdsl::size_in_bytes(der) +
+               sdsl::size_in_bytes(euler) + sdsl::size_in_bytes(primera) +
+               sdsl::size_in_bytes(tipo) + sdsl::size_in_bytes(prof_ini) +
+               sdsl::size_in_bytes(min_bloque) + st.bytes() + tabla.size();
+    }
+
+    // ---- construcción ----
+
+    // Pila de la rama derecha: al llegar i se sacan los mayores estrictos;
+    // el último sacado pasa a ser hijo izquierdo de i e i hijo derecho del tope.
+    void build_arbol() {
+        const sdsl::int_vector<>& a = *A;
+        size_t n = a.size();
+        std::vector<uint64_t> pila;
+        pila.reserve(64);
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t ultimo = NULO;
+            while (!pila.empty() && a[pila.back()] > a[i]) {
+                ultimo = pila.back();
+                pila.pop_back();
+            }
+            if (ultimo != NULO) {
+                izq[i] = ultimo;
+                padre[ultimo] = i;
+            }
+            if (!pila.empty()) {
+                der[pila.back()] = i;
+                padre[i] = pila.back();
+            }
+            pila.push_back(i);
+        }
+        raiz = pila.front();
+    }
+
+    // Euler tour iterativo usando los punteros al padre (el árbol puede tener
+    // profundidad n, p.ej. con A ordenado, así que no se usa recursión).
+    void build_euler(uint8_t w) {
+        size_t n = A->size();
+        size_t m = 2 * n - 1;
+        euler = sdsl::int_vector<>(m, 0, w);
+        // primera guarda posiciones del tour (hasta m - 1), no nodos
+        primera = sdsl::int_vector<>(n, 0, static_cast<uint8_t>(sdsl::bits::hi(m) + 1));
+        std::vector<uint64_t> sube((m + 63) / 64, 0);  // bit k: la profundidad sube de k a k+1
+
+        size_t k = 0;
+        uint64_t cur = raiz, prev = NULO;
+        euler[k] = cur;
+        primera[cur] = k;
+        while (true) {
+            uint64_t sig = NULO;
+            if (prev == padre[cur]) {
+                sig = (izq[cur] != NULO) ? izq[cur] : der[cur];
+            } else if (prev == izq[cur]) {
+                sig = der[cur];
+            }
+            if (sig != NULO) {
+                sube[k / 64] |= 1ULL << (k % 64);
+                prev = cur;
+                cur = sig;
+                euler[++k] = cur;
+                primera[cur] = k;
+                continue;
+            }
+            if (cur == raiz) break;
+            prev = cur;
+            cur = padre[cur];
+            euler[++k] = cur;
+        }
+
+        // Bloques de b pasos; b ~ log2(m) / 2 para que la tabla sea O(sqrt(m) log^2 m)
+        b = sdsl::bits::hi(m) / 2;
+        if (b < 2) b = 2;
+        if (b > 16) b = 16;
+        size_t nb = (m + b - 1) / b;
+        uint8_t wd = static_cast<uint8_t>(sdsl::bits::hi(n) + 1);
+        tipo = sdsl::int_vector<>(nb, 0, static_cast<uint8_t>(b - 1));
+        prof_ini = sdsl::int_vector<>(nb, 0, wd);
+        min_bloque = sdsl::int_vector<>(nb, 0, wd);
+
+        uint64_t d = 0;
+        for (size_t blq = 0; blq < nb; ++blq) {
+            prof_ini[blq] = d;
+            uint64_t t = 0;
+            uint64_t dmin = d;
+            for (uint32_t s = 0; s + 1 < b; ++s) {
+                size_t p = blq * b + s;
+                // Pasos fuera del tour se rellenan con +1: no afectan mínimos
+                bool arriba = (p + 1 >= m) || ((sube[p / 64] >> (p % 64)) & 1);
+                if (arriba) {
+                    t |= 1ULL << s;
+                    ++d;
+                } else {
+                    --d;
+                    if (d < dmin) dmin = d;
+                }
+            }
+            tipo[blq] = t;
+            min_bloque[blq] = dmin;
+            // Paso entre el último del bloque y el primero del siguiente
+            size_t p = blq * b + b - 1;
+            if (p + 1 < m) {
+                if ((sube[p / 64] >> (p % 64)) & 1) ++d;
+                else --d;
+            }
+        }
+    }
+
+    void build_pm1() {
+        size_t tipos = static_cast<size_t>(1) << (b - 1);
+        tabla.assign(tipos * b * b, 0);
+        for (size_t t = 0; t < tipos; ++t) {
+            for (uint32_t i = 0; i < b; ++i) {
+                int64_t d = 0, dmin = 0;
+                uint32_t pos = i;
+                tabla[(t * b + i) * b + i] = static_cast<uint8_t>(i);
+                for (uint32_t j = i + 1; j < b; ++j) {
+                    d += ((t >> (j - 1)) & 1) ? 1 : -1;
+                    if (d < dmin) {
+                        dmin = d;
+                        pos = j;
+                    }
+                    tabla[(t * b + i) * b + j] = static_cast<uint8_t>(pos);
+                }
+            }
+        }
+        st.build(&min_bloque);
+    }
+
+    // ---- consulta ----
+
+    uint64_t prof(size_t k) const {
+        size_t blq = k / b;
+        uint32_t o = static_cast<uint32_t>(k % b);
+        uint64_t t = tipo[blq] & ((1ULL << o) - 1);
+        return prof_ini[blq] + 2 * sdsl::bits::cnt(t) - o;
+    }
+
+    size_t en_bloque(size_t blq, uint32_t i, uint32_t j) const {
+        return blq * b + tabla[(tipo[blq] * b + i) * b + j];
+    }
+
+    // Posición del tour con profundidad mínima en [i, j]
+    size_t rmq_pm1(size_t i, size_t j) const {
+        size_t bi = i / b, bj = j / b;
+        if (bi == bj) return en_bloque(bi, i % b, j % b);
+
+        size_t mejor = en_bloque(bi, i % b, b - 1);
+        uint64_t pmejor = prof(mejor);
+        if (bj > bi + 1) {
+            size_t blq = st(bi + 1, bj - 1);
+            size_t c = en_bloque(blq, 0, b - 1);
+            uint64_t pc = prof(c);
+            if (pc < pmejor) {
+                mejor = c;
+                pmejor = pc;
+            }
+        }
+        size_t c = en_bloque(bj, 0, j % b);
+        if (prof(c) < pmejor) mejor = c;
+        return mejor;
+    }
+};
+
+#endif // RMQ_CARTESIAN_TREE_HPP
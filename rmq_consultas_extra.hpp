@@ -0,0 +1,349 @@
+// rmq_consultas_extra.hpp
+// Consultas derivadas del RMQ, para no tener que emitir k consultas Q desde
+// afuera:
+//
+//   top_k            los k menores de [l, r] (en orden), partiendo el rango en
+//                    el mínimo y usando un heap de subrangos: O(k log k) RMQs
+//   primero_menor    primera posición de [desde, hasta] con valor < t, con
+//                    búsqueda galopante sobre el RMQ: O(log distancia) RMQs
+//   reportar_menores todas las posiciones de [l, r] con valor < t, en orden.
+//                    Genérico: primero_menor repetido. Para el segment tree se
+//                    usa un descenso por el árbol que poda nodos con mínimo >= t.
+//   siguiente_menor  siguiente posición a la derecha de i con valor < A[i]
+//
+// Funcionan con cualquier estructura con operator()(l, r) const que devuelva
+// el índice del mínimo. comandos_extra agrega los comandos K, C, R y N al loop
+// de rmq_server, con un CSV de latencias por tipo de consulta.
+#ifndef RMQ_CONSULTAS_EXTRA_HPP
+#define RMQ_CONSULTAS_EXTRA_HPP
+
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <sdsl/int_vector.hpp>
+
+#include "rmq_buffers.hpp"
+#include "rmq_segment_tree.hpp"
+
+static const uint64_t RMQ_NINGUNO = ~0ULL;
+
+// ---- top-k ----
+
+struct nodo_top_k {
+    uint64_t valor, idx, l, r;
+};
+
+// Orden de heap de mínimos por (valor, índice)
+struct mayor_top_k {
+    bool operator()(const nodo_top_k& a, const nodo_top_k& b) const {
+        if (a.valor != b.valor) return a.valor > b.valor;
+        return a.idx > b.idx;
+    }
+};
+
+// Escribe en salida los índices de los k menores de [l, r] en orden creciente
+// (empate: menor índice) y devuelve cuántos escribió. heap es espacio de
+// trabajo: con capacidad reservada >= k + 1 no se asigna memoria.
+template <class Rmq>
+size_t top_k(const sdsl::int_vector<>& A, const Rmq& rmq, size_t l, size_t r, size_t k,
+             std::vector<nodo_top_k>& heap, uint64_t* salida) {
+    heap.clear();
+    if (l > r || k == 0) return 0;
+    mayor_top_k cmp;
+    uint64_t m = rmq(l, r);
+    nodo_top_k raiz = {A[m], m, l, r};
+    heap.push_back(raiz);
+
+    size_t c = 0;
+    while (c < k && !heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), cmp);
+        nodo_top_k x = heap.back();
+        heap.pop_back();
+        salida[c++] = x.idx;
+        if (x.l < x.idx) {
+            uint64_t mi = rmq(x.l, x.idx - 1);
+            nodo_top_k izq = {A[mi], mi, x.l, x.idx - 1};
+            heap.push_back(izq);
+            std::push_heap(heap.begin(), heap.end(), cmp);
+        }
+        if (x.idx < x.r) {
+            uint64_t md = rmq(x.idx + 1, x.r);
+            nodo_top_k der = {A[md], md, x.idx + 1, x.r};
+            heap.push_back(der);
+            std::push_heap(heap.begin(), heap.end(), cmp);
+        }
+    }
+    return c;
+}
+
+// ---- umbral / siguiente menor ----
+
+// Primera posición j en [desde, hasta] con A[j] < t, o RMQ_NINGUNO.
+// Galopa con ventanas de largo 1, 2, 4, ... y luego busca binariamente
+// dentro de la ventana que contiene la respuesta.
+template <class Rmq>
+uint64_t primero_menor(const sdsl::int_vector<>& A, const Rmq& rmq,
+                       size_t desde, size_t hasta, uint64_t t) {
+    if (desde > hasta) return RMQ_NINGUNO;
+    size_t ini = desde;
+    size_t largo = 1;
+    while (true) {
+        size_t fin = (hasta - ini < largo - 1) ? hasta : ini + largo - 1;
+        if (A[rmq(ini, fin)] < t) {
+            // min(ini..lo-1) >= t y min(ini..hi) < t
+            size_t lo = ini, hi = fin;
+            while (lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (A[rmq(lo, mid)] < t) hi = mid;
+                else lo = mid + 1;
+            }
+            return lo;
+        }
+        if (fin == hasta) return RMQ_NINGUNO;
+        ini = fin + 1;
+        largo *= 2;
+    }
+}
+
+template <class Rmq>
+uint64_t siguiente_menor(const sdsl::int_vector<>& A, const Rmq& rmq, size_t i) {
+    if (i + 1 >= A.size()) return RMQ_NINGUNO;
+    return primero_menor(A, rmq, i + 1, A.size() - 1, A[i]);
+}
+
+// Llama f(j) para cada j en [l, r] con A[j] < t, en orden creciente de j
+template <class Rmq, class F>
+void reportar_menores(const sdsl::int_vector<>& A, const Rmq& rmq,
+                      size_t l, size_t r, uint64_t t, F& f) {
+    uint64_t j = primero_menor(A, rmq, l, r, t);
+    while (j != RMQ_NINGUNO) {
+        f(j);
+        if (j == r) break;
+        j = primero_menor(A, rmq, j + 1, r, t);
+    }
+}
+
+template <class t_idx, class F>
+void descender_menores(const sdsl::int_vector<>& A, const rmq_segment_tree_t<t_idx>& st,
+                       size_t p, uint64_t t, F& f) {
+    if (A[st.nodo(p)] >= t) return;  // todo el subárbol es >= t
+    if (p >= st.n) {
+        f(p - st.n);
+        return;
+    }
+    descender_menores(A, st, 2 * p, t, f);
+    descender_menores(A, st, 2 * p + 1, t, f);
+}
+
+// Segment tree: descenso con poda sobre los nodos canónicos de [l, r]
+template <class t_idx, class F>
+void reportar_menores(const sdsl::int_vector<>& A, const rmq_segment_tree_t<t_idx>& st,
+                      size_t l, size_t r, uint64_t t, F& f) {
+    size_t n = st.n;
+    if (n == 0 || l > r) return;
+    if (r >= n) r = n - 1;
+    size_t der[128];  // nodos canónicos derechos, se visitan al final en orden
+    int nd = 0;
+    for (size_t lo = l + n, hi = r + n + 1; lo < hi; lo >>= 1, hi >>= 1) {
+        if (lo & 1) descender_menores(A, st, lo++, t, f);
+        if (hi & 1) der[nd++] = --hi;
+    }
+    while (nd > 0) descender_menores(A, st, der[--nd], t, f);
+}
+
+// ---- comandos K / C / R / N para el loop de rmq_server ----
+
+// Acumula el conteo y guarda las primeras posiciones para mostrarlas
+struct colector_menores {
+    static const size_t MOSTRAR = 32;
+    uint64_t cantidad;
+    uint64_t primeras[MOSTRAR];
+
+    colector_menores() : cantidad(0) {}
+
+    void operator()(uint64_t j) {
+        if (cantidad < MOSTRAR) primeras[cantidad] = j;
+        ++cantidad;
+    }
+};
+
+struct contador_menores {
+    uint64_t cantidad;
+
+    contador_menores() : cantidad(0) {}
+
+    void operator()(uint64_t) { ++cantidad; }
+};
+
+// Maneja los comandos:
+//   K l r k   -> los k menores de [l, r]
+//   C l r t   -> cuántos valores < t hay en [l, r]
+//   R l r t   -> posiciones con valor < t en [l, r]
+//   N i       -> siguiente menor a la derecha de i
+// Cada tipo escribe su CSV <tipo>-rmq-<motor>.csv, que se abre la primera
+// vez que se usa. Todo el espacio de trabajo se reserva en el constructor.
+template <class Rmq>
+struct comandos_extra {
+    static const size_t K_MAX = 1 << 16;
+
+    const sdsl::int_vector<>& A;
+    const Rmq& rmq;
+    buffer_salida& out;
+    const char* motor;
+
+    std::vector<nodo_top_k> heap;
+    std::vector<uint64_t> resultado;
+    buffer_salida csv_topk, csv_conteo, csv_reporte, csv_siguiente;
+
+    comandos_extra(const sdsl::int_vector<>& a, const Rmq& r, buffer_salida& o, const char* m)
+        : A(a), rmq(r), out(o), motor(m) {
+        heap.reserve(K_MAX + 1);
+        resultado.resize(K_MAX);
+    }
+
+    static bool es_comando(char op) {
+        return op == 'K' || op == 'k' || op == 'C' || op == 'c' ||
+               op == 'R' || op == 'r' || op == 'N' || op == 'n';
+    }
+
+    // p apunta justo después de la letra del comando
+    void ejecutar(char op, const char* p, const char* fin) {
+        if (op == 'N' || op == 'n') {
+            uint64_t i;
+            if (!leer_sin_signo(p, fin, i)) {
+                out.texto("Formato inválido. Usa: N i\n");
+                return;
+            }
+            if (i >= A.size()) {
+                fuera_de_rango();
+                return;
+            }
+            siguiente(i);
+            return;
+        }
+
+        uint64_t l, r, x;
+        if (!leer_sin_signo(p, fin, l) || !leer_sin_signo(p, fin, r) ||
+            !leer_sin_signo(p, fin, x)) {
+            out.texto("Formato inválido. Usa: K l r k  |  C l r t  |  R l r t  |  N i\n");
+            return;
+        }
+        if (l > r) {
+            uint64_t tmp = l;
+            l = r;
+            r = tmp;
+        }
+        if (r >= A.size()) {
+            fuera_de_rango();
+            return;
+        }
+        if (op == 'K' || op == 'k') topk(l, r, x);
+        else if (op == 'C' || op == 'c') conteo(l, r, x);
+        else reporte(l, r, x);
+    }
+
+    void fuera_de_rango() {
+        out.texto("Rango fuera de límites. El arreglo tiene tamaño ")
+           .sin_signo(A.size()).texto(" (índices 0..")
+           .sin_signo(A.size() - 1).texto(").\n");
+    }
+
+    void abrir(buffer_salida& csv, const char* tipo) {
+        if (csv.fd != -1) return;
+        char ruta[256];
+        snprintf(ruta, sizeof(ruta), "%s-rmq-%s.csv", tipo, motor);
+        if (!csv.abrir_append(ruta)) {
+            out.texto("Advertencia: no se pudo abrir ").texto(ruta).texto(" para escritura.\n");
+        }
+    }
+
+    void topk(size_t l, size_t r, uint64_t k) {
+        if (k > K_MAX) k = K_MAX;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        size_t c = top_k(A, rmq, l, r, k, heap, resultado.data());
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+        out.texto("Top-").sin_signo(c).texto(" en [").sin_signo(l).texto(", ")
+           .sin_signo(r).texto("]:");
+        for (size_t j = 0; j < c && j < colector_menores::MOSTRAR; ++j) {
+            out.texto(" A[").sin_signo(resultado[j]).texto("]=").sin_signo(A[resultado[j]]);
+        }
+        if (c > colector_menores::MOSTRAR) out.texto(" ...");
+        out.caracter('\n');
+        out.texto("Tiempo de consulta: ").entero(ns).texto(" ns\n");
+
+        // CSV: size,rango,k,tiempo_ns
+        abrir(csv_topk, "topk");
+        csv_topk.sin_signo(A.size()).caracter(',').sin_signo(r - l + 1).caracter(',')
+                .sin_signo(c).caracter(',').entero(ns).caracter('\n');
+    }
+
+    void conteo(size_t l, size_t r, uint64_t t) {
+        contador_menores f;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        reportar_menores(A, rmq, l, r, t, f);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+        out.texto("Valores < ").sin_signo(t).texto(" en [").sin_signo(l).texto(", ")
+           .sin_signo(r).texto("]: ").sin_signo(f.cantidad).caracter('\n');
+        out.texto("Tiempo de consulta: ").entero(ns).texto(" ns\n");
+
+        // CSV: size,rango,cantidad,tiempo_ns
+        abrir(csv_conteo, "conteo");
+        csv_conteo.sin_signo(A.size()).caracter(',').sin_signo(r - l + 1).caracter(',')
+                  .sin_signo(f.cantidad).caracter(',').entero(ns).caracter('\n');
+    }
+
+    void reporte(size_t l, size_t r, uint64_t t) {
+        colector_menores f;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        reportar_menores(A, rmq, l, r, t, f);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+        out.texto("Posiciones con valor < ").sin_signo(t).texto(" en [").sin_signo(l)
+           .texto(", ").sin_signo(r).texto("] (").sin_signo(f.cantidad).texto("):");
+        for (size_t j = 0; j < f.cantidad && j < colector_menores::MOSTRAR; ++j) {
+            out.caracter(' ').sin_signo(f.primeras[j]);
+        }
+        if (f.cantidad > colector_menores::MOSTRAR) out.texto(" ...");
+        out.caracter('\n');
+        out.texto("Tiempo de consulta: ").entero(ns).texto(" ns\n");
+
+        // CSV: size,rango,cantidad,tiempo_ns
+        abrir(csv_reporte, "reporte");
+        csv_reporte.sin_signo(A.size()).caracter(',').sin_signo(r - l + 1).caracter(',')
+                   .sin_signo(f.cantidad).caracter(',').entero(ns).caracter('\n');
+    }
+
+    void siguiente(size_t i) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        uint64_t j = siguiente_menor(A, rmq, i);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+
+        out.texto("Siguiente menor a la derecha de ").sin_signo(i)
+           .texto(" (A[").sin_signo(i).texto("] = ").sin_signo(A[i]).texto("): ");
+        if (j == RMQ_NINGUNO) {
+            out.texto("no existe\n");
+        } else {
+            out.texto("índice ").sin_signo(j).texto(" (A[").sin_signo(j).texto("] = ")
+               .sin_signo(A[j]).texto(")\n");
+        }
+        out.texto("Tiempo de consulta: ").entero(ns).texto(" ns\n");
+
+        // CSV: size,indice,distancia (0 si no existe),tiempo_ns
+        abrir(csv_siguiente, "siguiente-menor");
+        csv_siguiente.sin_signo(A.size()).caracter(',').sin_signo(i).caracter(',')
+                     .sin_signo(j == RMQ_NINGUNO ? 0 : j - i).caracter(',')
+                     .entero(ns).caracter('\n');
+    }
+};
+
+#endif // RMQ_CONSULTAS_EXTRA_HPP
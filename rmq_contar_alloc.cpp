@@ -0,0 +1,32 @@
+// rmq_contar_alloc.cpp
+// Reemplazo del operator new global que cuenta asignaciones (ver control_alloc
+// en rmq_buffers.hpp). Solo se compila dentro de la variante -alloc de librmq;
+// el enlazador lo trae porque control_alloc referencia rmq_alloc_contador.
+#ifdef RMQ_CONTAR_ALLOC
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "rmq_buffers.hpp"
+
+size_t rmq_alloc_contador = 0;
+
+void* operator new(size_t n) {
+    ++rmq_alloc_contador;
+    void* p = std::malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void* operator new[](size_t n) {
+    ++rmq_alloc_contador;
+    void* p = std::malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+#endif // RMQ_CONTAR_ALLOC
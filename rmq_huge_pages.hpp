@@ -0,0 +1,166 @@
+// rmq_huge_pages.hpp
+// Almacenamiento opcional en páginas de 2 MB para arreglos de ~10^9 elementos,
+// donde las páginas de 4 KB hacen que casi cada acceso del árbol falle en la
+// dTLB. El modo se elige con la variable de entorno RMQ_HUGEPAGES:
+//
+//   off (default)  páginas normales
+//   thp            mmap alineado a 2 MB + madvise(MADV_HUGEPAGE)
+//   hugetlb        mmap(MAP_HUGETLB) con páginas reservadas por el sistema
+//                  (vm.nr_hugepages); si no hay, cae a thp con un aviso
+//
+// Todo es "best effort": si el kernel no soporta un modo se sigue con el
+// siguiente más simple, nunca se aborta por esto.
+#ifndef RMQ_HUGE_PAGES_HPP
+#define RMQ_HUGE_PAGES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <exception>
+
+#include <sys/mman.h>
+
+#include <sdsl/memory_management.hpp>
+
+static const size_t RMQ_HUGE_PAGE = 2 * 1024 * 1024;
+
+enum rmq_modo_paginas { PAGINAS_NORMALES = 0, PAGINAS_THP = 1, PAGINAS_HUGETLB = 2 };
+
+inline rmq_modo_paginas rmq_leer_modo_paginas() {
+    const char* s = getenv("RMQ_HUGEPAGES");
+    if (s == nullptr) return PAGINAS_NORMALES;
+    if (strcmp(s, "thp") == 0) return PAGINAS_THP;
+    if (strcmp(s, "hugetlb") == 0) return PAGINAS_HUGETLB;
+    return PAGINAS_NORMALES;
+}
+
+// Modo leído una sola vez por proceso
+inline rmq_modo_paginas rmq_modo_paginas_actual() {
+    static const rmq_modo_paginas modo = rmq_leer_modo_paginas();
+    return modo;
+}
+
+inline const char* rmq_nombre_modo_paginas(rmq_modo_paginas m) {
+    switch (m) {
+        case PAGINAS_THP: return "thp (madvise)";
+        case PAGINAS_HUGETLB: return "hugetlb (MAP_HUGETLB)";
+        default: return "normales (4 KB)";
+    }
+}
+
+inline size_t rmq_redondear_huge(size_t bytes) {
+    return (bytes + RMQ_HUGE_PAGE - 1) / RMQ_HUGE_PAGE * RMQ_HUGE_PAGE;
+}
+
+// Marca como candidato a THP el rango de páginas de 2 MB completas dentro de
+// [p, p + bytes). Sirve para memoria que no se asignó con rmq_alloc_huge
+// (p.ej. el int_vector<> de SDSL). Hay que llamarla antes de tocar la
+// memoria: las páginas ya escritas quedan en 4 KB hasta que khugepaged las
+// compacte.
+inline void rmq_aconsejar_thp(const void* p, size_t bytes) {
+#ifdef MADV_HUGEPAGE
+    uintptr_t ini = (reinterpret_cast<uintptr_t>(p) + RMQ_HUGE_PAGE - 1) & ~(RMQ_HUGE_PAGE - 1);
+    uintptr_t fin = (reinterpret_cast<uintptr_t>(p) + bytes) & ~(RMQ_HUGE_PAGE - 1);
+    if (fin > ini) {
+        madvise(reinterpret_cast<void*>(ini), fin - ini, MADV_HUGEPAGE);
+    }
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+// Memoria anónima de 'bytes' (múltiplo de 2 MB) alineada a 2 MB, con
+// MAP_HUGETLB si se pide y hay páginas reservadas, o con THP si no.
+// Devuelve nullptr si mmap falla.
+inline void* rmq_mmap_huge(size_t bytes, bool hugetlb) {
+#ifdef MAP_HUGETLB
+    if (hugetlb) {
+        void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) return p;
+        static bool avisado = false;
+        if (!avisado) {
+            fprintf(stderr, "Advertencia: MAP_HUGETLB no disponible (vm.nr_hugepages?), se usa THP.\n");
+            avisado = true;
+        }
+    }
+#else
+    (void)hugetlb;
+#endif
+    // Pedir 2 MB extra y recortar para quedar alineados a 2 MB
+    size_t total = bytes + RMQ_HUGE_PAGE;
+    void* base = mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) return nullptr;
+    uintptr_t b = reinterpret_cast<uintptr_t>(base);
+    uintptr_t alineado = (b + RMQ_HUGE_PAGE - 1) & ~(RMQ_HUGE_PAGE - 1);
+    if (alineado > b) munmap(base, alineado - b);
+    uintptr_t fin = alineado + bytes;
+    if (b + total > fin) munmap(reinterpret_cast<void*>(fin), b + total - fin);
+    rmq_aconsejar_thp(reinterpret_cast<void*>(alineado), bytes);
+    return reinterpret_cast<void*>(alineado);
+}
+
+// Allocator para std::vector que respeta RMQ_HUGEPAGES. Bloques chicos
+// (< 2 MB) o modo off usan operator new como siempre.
+template <class T>
+struct rmq_alloc_huge {
+    typedef T value_type;
+
+    rmq_alloc_huge() {}
+    template <class U>
+    rmq_alloc_huge(const rmq_alloc_huge<U>&) {}
+
+    static bool usa_mmap(size_t bytes) {
+        return rmq_modo_paginas_actual() != PAGINAS_NORMALES && bytes >= RMQ_HUGE_PAGE;
+    }
+
+    T* allocate(size_t n) {
+        size_t bytes = n * sizeof(T);
+        if (usa_mmap(bytes)) {
+            void* p = rmq_mmap_huge(rmq_redondear_huge(bytes),
+                                    rmq_modo_paginas_actual() == PAGINAS_HUGETLB);
+            if (p == nullptr) throw std::bad_alloc();
+            return static_cast<T*>(p);
+        }
+        return static_cast<T*>(::operator new(bytes));
+    }
+
+    void deallocate(T* p, size_t n) {
+        size_t bytes = n * sizeof(T);
+        if (usa_mmap(bytes)) {
+            munmap(p, rmq_redondear_huge(bytes));
+        } else {
+            ::operator delete(p);
+        }
+    }
+};
+
+template <class T, class U>
+bool operator==(const rmq_alloc_huge<T>&, const rmq_alloc_huge<U>&) { return true; }
+template <class T, class U>
+bool operator!=(const rmq_alloc_huge<T>&, const rmq_alloc_huge<U>&) { return false; }
+
+// Para el arreglo A (int_vector<> de SDSL): en modo hugetlb se le entrega a
+// SDSL un pool de páginas de 2 MB antes de crear A; si no se puede, se sigue
+// con THP. En modo thp se llama a rmq_aconsejar_thp() sobre A.data() antes
+// de escribir A (ver crear_arreglo en rmq_arreglo.cpp).
+// Desde acá todo int_vector<> sale del pool y SDSL lanza una excepción si se
+// agota, así que solo se llama cuando A es el único (ver rmq_cargar_arreglo).
+// Devuelve true si el pool quedó activo.
+inline bool rmq_preparar_arreglo_huge(size_t bytes_estimados) {
+    if (rmq_modo_paginas_actual() != PAGINAS_HUGETLB) return false;
+    try {
+        sdsl::memory_manager::use_hugepages(rmq_redondear_huge(bytes_estimados));
+        return true;
+    } catch (const std::exception& e) {
+        fprintf(stderr, "Advertencia: SDSL no pudo usar hugepages (%s), se usa THP.\n", e.what());
+        return false;
+    }
+}
+
+#endif // RMQ_HUGE_PAGES_HPP
@@ -0,0 +1,179 @@
+// rmq_motor.cpp
+// Motores de librmq: un envoltorio genérico sobre cada estructura y la tabla
+// de nombres que usa crear_motor(). Lo que cambia entre estructuras (cómo se
+// construyen, cómo absorben un update, cuánto ocupan) se resuelve con las
+// sobrecargas construir / actualizar / tamano / mostrar_stats.
+#include <cstring>
+
+#include <sdsl/rmq_support.hpp>
+#include <sdsl/util.hpp>
+
+#include "rmq_motor.hpp"
+#include "rmq_segment_tree.hpp"
+#include "rmq_sparse_table.hpp"
+#include "rmq_adaptativo.hpp"
+#include "rmq_block_sparse_table.hpp"
+#include "rmq_cartesian_tree.hpp"
+
+using namespace std;
+using namespace sdsl;
+
+namespace {
+
+typedef rmq_support_sparse_table<> rmq_sdsl_sparse_table;
+
+// ---- construcción ----
+
+template <class Rmq>
+void construir(Rmq& t, const int_vector<>* a) { t.build(a); }
+
+void construir(rmq_sdsl_sparse_table& t, const int_vector<>* a) { t = rmq_sdsl_sparse_table(a); }
+
+// ---- update (A[i] ya escrito) ----
+
+template <class Rmq>
+void actualizar(Rmq& t, const int_vector<>*, size_t i) { t.update(i); }
+
+// Estructuras estáticas: se reconstruyen completas
+void actualizar(rmq_sparse_table& t, const int_vector<>*, size_t) { t.rebuild(); }
+void actualizar(rmq_cartesian_tree& t, const int_vector<>*, size_t) { t.rebuild(); }
+void actualizar(rmq_sdsl_sparse_table& t, const int_vector<>* a, size_t) {
+    t = rmq_sdsl_sparse_table(a);
+}
+
+// ---- memoria ----
+
+template <class Rmq>
+size_t tamano(const Rmq& t) { return t.bytes(); }
+
+size_t tamano(const rmq_sdsl_sparse_table& t) { return size_in_bytes(t); }
+
+// ---- estadísticas ----
+
+template <class Rmq>
+void mostrar_stats(const Rmq&, ostream&) {}
+
+void mostrar_stats(const rmq_adaptativo& t, ostream& out) { t.stats(out); }
+
+// ---- consultas ----
+
+// Las plantillas de rmq_consultas_extra.hpp reciben el RMQ por referencia
+// const. El adaptativo actualiza sus estadísticas al consultar, así que se
+// pasa a través de este envoltorio.
+struct ref_adaptativo {
+    rmq_adaptativo* t;
+    uint64_t operator()(size_t l, size_t r) const { return (*t)(l, r); }
+};
+
+template <class Rmq>
+struct consultor {
+    typedef const Rmq& tipo;
+    static tipo de(Rmq& t) { return t; }
+};
+
+template <>
+struct consultor<rmq_adaptativo> {
+    typedef ref_adaptativo tipo;
+    static tipo de(rmq_adaptativo& t) {
+        ref_adaptativo r = {&t};
+        return r;
+    }
+};
+
+template <class Rmq>
+struct motor_generico : motor_rmq {
+    const char* nom;
+    const char* costo;
+    bool int_vectors;
+    const int_vector<>* A;
+    mutable Rmq t;  // mutable por el adaptativo (ver ref_adaptativo)
+
+    motor_generico(const char* n, const char* c, bool iv)
+        : nom(n), costo(c), int_vectors(iv), A(nullptr) {}
+
+    const char* nombre() const { return nom; }
+    const char* costo_update() const { return costo; }
+    bool crea_int_vectors() const { return int_vectors; }
+
+    void build(const int_vector<>* a) {
+        A = a;
+        construir(t, a);
+    }
+
+    uint64_t query(size_t l, size_t r) const { return t(l, r); }
+
+    void update(size_t i) { actualizar(t, A, i); }
+
+    size_t bytes() const { return tamano(t); }
+
+    void stats(ostream& out) const { mostrar_stats(t, out); }
+
+    size_t top_k(size_t l, size_t r, size_t k,
+                 vector<nodo_top_k>& heap, uint64_t* salida) const {
+        return ::top_k(*A, consultor<Rmq>::de(t), l, r, k, heap, salida);
+    }
+
+    uint64_t siguiente_menor(size_t i) const {
+        return ::siguiente_menor(*A, consultor<Rmq>::de(t), i);
+    }
+
+    void reportar_menores(size_t l, size_t r, uint64_t v, colector_menores& f) const {
+        ::reportar_menores(*A, consultor<Rmq>::de(t), l, r, v, f);
+    }
+
+    void reportar_menores(size_t l, size_t r, uint64_t v, contador_menores& f) const {
+        ::reportar_menores(*A, consultor<Rmq>::de(t), l, r, v, f);
+    }
+};
+
+template <class Rmq>
+motor_rmq* nuevo(const char* nombre, const char* costo, bool int_vectors) {
+    return new motor_generico<Rmq>(nombre, costo, int_vectors);
+}
+
+struct entrada_motor {
+    const char* nombre;
+    const char* costo_update;
+    bool crea_int_vectors;  // ver motor_rmq::crea_int_vectors
+    motor_rmq* (*crear)(const char*, const char*, bool);
+};
+
+// Solo el segment tree guarda todo en std::vector (con rmq_alloc_huge); el
+// resto arma sus tablas con int_vector<>
+const entrada_motor MOTORES[] = {
+    {"segment-tree", "update O(log n) en el árbol", false, nuevo<rmq_segment_tree>},
+    {"sparse-table", "reconstruye la tabla, O(n log n)", true, nuevo<rmq_sparse_table>},
+    {"sdsl-sparse-table", "reconstruye la tabla de SDSL, O(n log n)", true,
+     nuevo<rmq_sdsl_sparse_table>},
+    {"adaptativo", "segment tree O(log n); la sparse table se rehace según la carga", true,
+     nuevo<rmq_adaptativo>},
+    {"block-sparse-table-16", "rehace el bloque, O(16) + tabla de bloques si cambia su mínimo",
+     true, nuevo<rmq_block_sparse_table<16> >},
+    {"block-sparse-table-32", "rehace el bloque, O(32) + tabla de bloques si cambia su mínimo",
+     true, nuevo<rmq_block_sparse_table<32> >},
+    {"block-sparse-table-64", "rehace el bloque, O(64) + tabla de bloques si cambia su mínimo",
+     true, nuevo<rmq_block_sparse_table<64> >},
+    {"cartesian-tree", "reconstruye el árbol, O(n)", true, nuevo<rmq_cartesian_tree>},
+};
+
+} // namespace
+
+motor_rmq* crear_motor(const char* nombre) {
+    for (size_t k = 0; k < sizeof(MOTORES) / sizeof(MOTORES[0]); ++k) {
+        if (strcmp(nombre, MOTORES[k].nombre) == 0) {
+            return MOTORES[k].crear(MOTORES[k].nombre, MOTORES[k].costo_update,
+                                    MOTORES[k].crea_int_vectors);
+        }
+    }
+    return nullptr;
+}
+
+const char* nombre_motor(size_t k) {
+    return k < sizeof(MOTORES) / sizeof(MOTORES[0]) ? MOTORES[k].nombre : nullptr;
+}
+
+const char* nombres_motores() {
+    return "segment-tree | sparse-table | sdsl-sparse-table | adaptativo |\n"
+           "block-sparse-table-16 | block-sparse-table-32 | block-sparse-table-64 |\n"
+           "cartesian-tree";
+}
@@ -0,0 +1,79 @@
+// rmq_motor.hpp
+// Interfaz común de los motores RMQ de librmq. Cada estructura (segment tree,
+// sparse tables, árbol cartesiano, adaptativo) se envuelve en un motor_rmq y
+// se crea por nombre con crear_motor(), así rmq_server y rmq_workload usan el
+// mismo código compilado para todas y agregar un motor es agregar una entrada
+// en rmq_motor.cpp.
+#ifndef RMQ_MOTOR_HPP
+#define RMQ_MOTOR_HPP
+
+#include <vector>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+
+#include <sdsl/int_vector.hpp>
+
+#include "rmq_consultas_extra.hpp"
+
+struct motor_rmq {
+    virtual ~motor_rmq() {}
+
+    // Nombre con el que se creó (segment-tree, sparse-table, ...)
+    virtual const char* nombre() const = 0;
+    // Costo de un update, para la ayuda del loop de comandos
+    virtual const char* costo_update() const = 0;
+
+    virtual void build(const sdsl::int_vector<>* a) = 0;
+    // Índice del mínimo en [l, r], l <= r < n (empate: menor índice)
+    virtual uint64_t query(size_t l, size_t r) const = 0;
+    // A[i] ya fue escrito afuera; el motor rehace lo que dependa de él
+    virtual void update(size_t i) = 0;
+    virtual size_t bytes() const = 0;
+    // Estadísticas propias del motor, si tiene
+    virtual void stats(std::ostream&) const {}
+    // true si build() crea int_vector<> propios además de A. El pool hugetlb
+    // de SDSL se dimensiona solo para A, así que con estos motores A va a THP
+    virtual bool crea_int_vectors() const = 0;
+
+    // Consultas extra (rmq_consultas_extra.hpp) con la estructura concreta,
+    // para que cada motor use su RMQ sin llamada virtual por consulta y el
+    // segment tree su descenso con poda.
+    virtual size_t top_k(size_t l, size_t r, size_t k,
+                         std::vector<nodo_top_k>& heap, uint64_t* salida) const = 0;
+    virtual uint64_t siguiente_menor(size_t i) const = 0;
+    virtual void reportar_menores(size_t l, size_t r, uint64_t t, colector_menores& f) const = 0;
+    virtual void reportar_menores(size_t l, size_t r, uint64_t t, contador_menores& f) const = 0;
+};
+
+// Crea el motor por nombre; nullptr si no existe
+motor_rmq* crear_motor(const char* nombre);
+
+// Nombres válidos para crear_motor, separados por " | "
+const char* nombres_motores();
+
+// Nombre del k-ésimo motor, o nullptr si k >= cantidad de motores
+const char* nombre_motor(size_t k);
+
+// Sobrecargas para que comandos_extra<motor_rmq> despache al motor
+// (son preferidas sobre las plantillas genéricas por no ser plantillas)
+inline size_t top_k(const sdsl::int_vector<>&, const motor_rmq& m, size_t l, size_t r,
+                    size_t k, std::vector<nodo_top_k>& heap, uint64_t* salida) {
+    return m.top_k(l, r, k, heap, salida);
+}
+
+inline uint64_t siguiente_menor(const sdsl::int_vector<>&, const motor_rmq& m, size_t i) {
+    return m.siguiente_menor(i);
+}
+
+inline void reportar_menores(const sdsl::int_vector<>&, const motor_rmq& m,
+                             size_t l, size_t r, uint64_t t, colector_menores& f) {
+    m.reportar_menores(l, r, t, f);
+}
+
+inline void reportar_menores(const sdsl::int_vector<>&, const motor_rmq& m,
+                             size_t l, size_t r, uint64_t t, contador_menores& f) {
+    m.reportar_menores(l, r, t, f);
+}
+
+#endif // RMQ_MOTOR_HPP
@@ -0,0 +1,115 @@
+// rmq_segment_tree.hpp
+// Segment tree de librmq: motor segment-tree y parte del adaptativo.
+#ifndef RMQ_SEGMENT_TREE_HPP
+#define RMQ_SEGMENT_TREE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include <sdsl/int_vector.hpp>
+
+#include "rmq_huge_pages.hpp"
+
+// Segment Tree estilo rmq_*: trabaja sobre un int_vector<> externo
+// y entrega el índice del mínimo en [l, r]. Además permite updates O(log n).
+//
+// Árbol iterativo (bottom-up) de tamaño exacto: los nodos internos son
+// 1..n-1 y las hojas n..2n-1 no se guardan, porque la hoja n + i siempre vale
+// i. Así el árbol ocupa n - 1 índices de t_idx en vez de 4n enteros.
+// t_idx = uint32_t alcanza hasta ~4.29e9 elementos; para más, uint64_t
+// (modo de arreglos grandes, -DRMQ_INDICES_64).
+template <class t_idx>
+struct rmq_segment_tree_t {
+    typedef t_idx indice_t;
+    static const uint64_t NINGUNO = ~0ULL;  // índice inválido
+
+    const sdsl::int_vector<>* A;  // puntero al arreglo original
+    size_t n;
+    std::vector<t_idx, rmq_alloc_huge<t_idx> > st;  // st[p] guarda índice del mínimo en el nodo p
+
+    rmq_segment_tree_t() : A(nullptr), n(0) {}
+
+    rmq_segment_tree_t(const sdsl::int_vector<>* a) {
+        build(a);
+    }
+
+    // ¿Caben los índices de un arreglo de tamaño m en t_idx?
+    static bool cabe(size_t m) {
+        return m == 0 || static_cast<uint64_t>(m - 1) <= std::numeric_limits<t_idx>::max();
+    }
+
+    // Lanza std::length_error si los índices de a no caben en t_idx (lo
+    // atrapa quien construye el motor; el resto de los motores no tiene
+    // este límite)
+    void build(const sdsl::int_vector<>* a) {
+        if (!cabe(a->size())) {
+            throw std::length_error("el arreglo no cabe en índices de 32 bits del segment tree; "
+                                    "compilar con -DRMQ_INDICES_64 (make large)");
+        }
+        A = a;
+        n = A->size();
+        st.clear();
+        if (n < 2) return;
+        st.assign(n, 0);  // st[0] no se usa
+        for (size_t p = n - 1; p >= 1; --p) {
+            st[p] = static_cast<t_idx>(combine(nodo(2 * p), nodo(2 * p + 1)));
+        }
+    }
+
+    // Valor (índice del mínimo) de un nodo, interno u hoja
+    uint64_t nodo(size_t p) const {
+        return p >= n ? p - n : st[p];
+    }
+
+    // Combina dos índices devolviendo el índice del mínimo (empate: menor índice)
+    uint64_t combine(uint64_t i, uint64_t j) const {
+        if (i == NINGUNO) return j;
+        if (j == NINGUNO) return i;
+        auto vi = (*A)[i];
+        auto vj = (*A)[j];
+        if (vi < vj) return i;
+        if (vj < vi) return j;
+        return (i < j ? i : j);
+    }
+
+    // Query pública: índice del mínimo en [l, r], o NINGUNO si el rango es inválido
+    uint64_t query(size_t l, size_t r) const {
+        if (!A || n == 0) return NINGUNO;
+        if (r >= n) r = n - 1;
+        if (l > r) return NINGUNO;
+        uint64_t res_izq = NINGUNO, res_der = NINGUNO;
+        for (size_t lo = l + n, hi = r + n + 1; lo < hi; lo >>= 1, hi >>= 1) {
+            if (lo & 1) res_izq = combine(res_izq, nodo(lo++));
+            if (hi & 1) res_der = combine(nodo(--hi), res_der);
+        }
+        return combine(res_izq, res_der);
+    }
+
+    uint64_t operator()(size_t l, size_t r) const {
+        return query(l, r);
+    }
+
+    // Update pública: ya se actualizó A[idx] afuera; aquí solo se recalcula
+    // el camino de la hoja a la raíz
+    void update(size_t idx) {
+        if (!A || idx >= n) return;
+        for (size_t p = (idx + n) >> 1; p >= 1; p >>= 1) {
+            st[p] = static_cast<t_idx>(combine(nodo(2 * p), nodo(2 * p + 1)));
+        }
+    }
+
+    size_t bytes() const {
+        return st.size() * sizeof(t_idx);
+    }
+};
+
+#ifdef RMQ_INDICES_64
+typedef rmq_segment_tree_t<uint64_t> rmq_segment_tree;
+#else
+typedef rmq_segment_tree_t<uint32_t> rmq_segment_tree;
+#endif
+
+#endif // RMQ_SEGMENT_TREE_HPP
@@ -0,0 +1,91 @@
+// rmq_server.cpp
+// Binario único de experimentos RMQ: reemplaza a RMQ-Sparse-Table-Static,
+// RMQ-Sparse-Table-Dinamic, RMQ-Segment-Tree-Static, RMQ-Segment-Tree-Dinamic
+// y RMQ-Cartesian-Tree-Static. El motor y el modo se eligen por opción; el
+// resto (carga, construcción, loop de comandos, CSV) vive en librmq.
+//
+// Uso:
+//   rmq_server [--motor m] [--modo static|dinamic] [--vmax v] dataset
+//       dataset: archivo de enteros o "aleatorio:N"
+//       --motor  default segment-tree (ver nombres_motores())
+//       --modo   static (default): solo consultas; dinamic: también U i v
+//       --vmax   mayor valor que pueden escribir los updates (default 9999,
+//                el rango de generar_datasets_rmq.py)
+//       RMQ_HUGEPAGES=off|thp|hugetlb elige páginas de 2 MB para A y el árbol
+//       (hugetlb para A solo con segment-tree; el resto usa THP para A)
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+#include <sdsl/int_vector.hpp>
+
+#include "rmq_motor.hpp"
+#include "rmq_arreglo.hpp"
+#include "rmq_servidor.hpp"
+
+using namespace std;
+using namespace sdsl;
+
+static void uso(const char* prog) {
+    cerr << "Uso: " << prog << " [--motor m] [--modo static|dinamic] [--vmax v] dataset\n"
+         << "  dataset: archivo de enteros separados por espacios o saltos de línea,\n"
+         << "           o aleatorio:N para N valores aleatorios en [0, vmax]\n"
+         << "  motor:\n" << nombres_motores() << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    const char* nombre_motor = "segment-tree";
+    bool dinamico = false;
+    uint64_t vmax = 9999;
+    const char* dataset = nullptr;
+
+    for (int k = 1; k < argc; ++k) {
+        string opt(argv[k]);
+        if (opt == "--motor" || opt == "--modo" || opt == "--vmax") {
+            if (k + 1 >= argc) {
+                cerr << "Error: falta el valor de " << opt << "\n";
+                return 1;
+            }
+            const char* v = argv[++k];
+            if (opt == "--motor") {
+                nombre_motor = v;
+            } else if (opt == "--vmax") {
+                vmax = strtoull(v, nullptr, 10);
+            } else if (string(v) == "static") {
+                dinamico = false;
+            } else if (string(v) == "dinamic") {
+                dinamico = true;
+            } else {
+                cerr << "Error: modo desconocido '" << v << "' (static o dinamic).\n";
+                return 1;
+            }
+        } else if (dataset == nullptr && opt.compare(0, 2, "--") != 0) {
+            dataset = argv[k];
+        } else {
+            cerr << "Error: opción desconocida " << opt << "\n";
+            uso(argv[0]);
+            return 1;
+        }
+    }
+    if (dataset == nullptr) {
+        uso(argv[0]);
+        return 1;
+    }
+
+    motor_rmq* motor = crear_motor(nombre_motor);
+    if (motor == nullptr) {
+        cerr << "Error: motor desconocido '" << nombre_motor << "'. Opciones:\n"
+             << nombres_motores() << "\n";
+        return 1;
+    }
+
+    int_vector<> A;
+    if (!rmq_cargar_arreglo(dataset, vmax, A, !motor->crea_int_vectors())) {
+        delete motor;
+        return 1;
+    }
+
+    int codigo = rmq_servir(*motor, A, dinamico);
+    delete motor;
+    return codigo;
+}
@@ -0,0 +1,252 @@
+// rmq_servidor.cpp
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <exception>
+
+#include "rmq_servidor.hpp"
+#include "rmq_arreglo.hpp"
+#include "rmq_buffers.hpp"
+#include "rmq_consultas_extra.hpp"
+#include "rmq_huge_pages.hpp"
+#include "rmq_segment_tree.hpp"
+
+using namespace std;
+using namespace sdsl;
+
+// Arreglos más grandes que esto no se imprimen completos al cargar
+static const size_t MOSTRAR_ARREGLO_MAX = 100;
+
+// Estado del loop de comandos: buffers fijos de entrada, salida y CSVs y
+// las consultas extra. Son ~400 KB, así que se piden al heap una vez por
+// llamada, antes del loop (alloc-check solo cuenta dentro del loop), y se
+// liberan al volver, con los CSV cerrados.
+struct estado_servidor {
+    char etiqueta[128];  // copia propia: extras guarda el puntero
+    buffer_salida out;
+    buffer_salida csv_q;
+    buffer_salida csv_u;
+    lector_lineas entrada;
+    comandos_extra<motor_rmq> extras;
+
+    estado_servidor(const int_vector<>& A, const motor_rmq& motor, const string& e)
+        : out(STDOUT_FILENO), entrada(STDIN_FILENO, &out), extras(A, motor, out, etiqueta) {
+        snprintf(etiqueta, sizeof(etiqueta), "%s", e.c_str());
+    }
+};
+
+int rmq_servir(motor_rmq& motor, int_vector<>& A, bool dinamico) {
+    const string etiqueta = string(motor.nombre()) + (dinamico ? "-dinamic" : "-static");
+
+    cout << "Arreglo cargado (" << A.size() << " elementos):\n";
+    if (A.size() <= MOSTRAR_ARREGLO_MAX) {
+        cout << "A = " << A << "\n\n";
+    } else {
+        cout << "A = (" << A.size() << " valores de " << static_cast<int>(A.width())
+             << " bits, no se imprime)\n\n";
+    }
+
+    // 1) Construcción midiendo tiempo y memoria
+    auto t_build_start = chrono::high_resolution_clock::now();
+    try {
+        motor.build(&A);
+    } catch (const exception& e) {
+        cerr << "Error: no se pudo construir el RMQ (" << e.what() << ").\n";
+        return 1;
+    }
+    auto t_build_end = chrono::high_resolution_clock::now();
+
+    auto build_ns =
+        chrono::duration_cast<chrono::nanoseconds>(t_build_end - t_build_start).count();
+
+    // Tamaño del RMQ en memoria (sin contar A) en MB
+    size_t rmq_bytes = motor.bytes();
+    double rmq_mb = static_cast<double>(rmq_bytes) / (1024.0 * 1024.0);
+
+    cout << "Construcción del RMQ (" << motor.nombre() << ", modo "
+         << (dinamico ? "dinámico" : "estático") << ") tomó " << build_ns << " ns\n";
+    cout << "Tamaño del RMQ en memoria ~ " << rmq_mb << " MB\n";
+    cout << "Índices de " << 8 * sizeof(rmq_segment_tree::indice_t) << " bits, páginas "
+         << rmq_nombre_modo_paginas(rmq_modo_paginas_actual()) << "\n";
+
+    // 1.b) CSV de construcción: size,rmq_mb,build_ns
+    {
+        const string ruta = "construccion-rmq-" + etiqueta + ".csv";
+        ofstream csv(ruta, ios::app);
+        if (!csv) {
+            cerr << "Advertencia: no se pudo abrir " << ruta << " para escritura.\n";
+        } else {
+            csv << A.size() << "," << rmq_mb << "," << build_ns << "\n";
+        }
+    }
+
+    // 2) Ayuda
+    cout << "\nListo para consultas RMQ.\n";
+    cout << "Comandos:\n";
+    cout << "  l r  o  Q l r -> consulta mínimo en [l, r] (índices 0-based, inclusive)\n";
+    if (dinamico) {
+        cout << "  U i v         -> update: A[i] = v (" << motor.costo_update() << ")\n";
+    }
+    cout << "  K l r k       -> los k menores de [l, r]\n";
+    cout << "  C l r t       -> cuántos valores < t hay en [l, r]\n";
+    cout << "  R l r t       -> posiciones con valor < t en [l, r]\n";
+    cout << "  N i           -> siguiente menor a la derecha de i\n";
+    cout << "  exit          -> salir\n\n";
+    cout.flush();
+
+    // 3) Loop de comandos sin asignaciones: buffers fijos para entrada,
+    //    salida y CSVs (los CSV se abren una sola vez)
+    unique_ptr<estado_servidor> estado(new estado_servidor(A, motor, etiqueta));
+    buffer_salida& out = estado->out;
+    buffer_salida& csv_q = estado->csv_q;
+    buffer_salida& csv_u = estado->csv_u;
+    lector_lineas& entrada = estado->entrada;
+    comandos_extra<motor_rmq>& extras = estado->extras;
+    {
+        const string ruta = "consultas-rmq-" + etiqueta + ".csv";
+        if (!csv_q.abrir_append(ruta.c_str())) {
+            cerr << "Advertencia: no se pudo abrir " << ruta << " para escritura.\n";
+        }
+    }
+    if (dinamico) {
+        const string ruta = "update-rmq-" + etiqueta + ".csv";
+        if (!csv_u.abrir_append(ruta.c_str())) {
+            cerr << "Advertencia: no se pudo abrir " << ruta << " para escritura.\n";
+        }
+    }
+    const uint64_t valor_max = rmq_valor_maximo(A);
+    control_alloc allocs;
+
+    const char* line;
+    size_t len;
+    while (true) {
+        out.texto("> ");
+        if (!entrada.siguiente(line, len)) {
+            break; // EOF
+        }
+
+        if (es_exit(line, len)) {
+            break;
+        }
+        if (len == 0) {
+            continue;
+        }
+
+        allocs.inicio();
+        const char* p = line;
+        const char* fin = line + len;
+        saltar_espacios(p, fin);
+
+        if (p == fin) {
+            out.texto("Entrada inválida. Usa: l r  o  Q l r  o 'exit'.\n");
+            allocs.fin();
+            continue;
+        }
+        char op = *p;
+        if (op == 'Q' || op == 'q' || (op >= '0' && op <= '9')) {
+            if (op == 'Q' || op == 'q') ++p;
+            uint64_t a, b;
+            if (!leer_sin_signo(p, fin, a) || !leer_sin_signo(p, fin, b)) {
+                out.texto("Formato de consulta inválido. Usa: l r  o  Q l r\n");
+                allocs.fin();
+                continue;
+            }
+
+            size_t l = min(a, b);
+            size_t r = max(a, b);
+
+            if (r >= A.size()) {
+                out.texto("Rango fuera de límites. El arreglo tiene tamaño ")
+                   .sin_signo(A.size()).texto(" (índices 0..")
+                   .sin_signo(A.size() - 1).texto(").\n");
+                allocs.fin();
+                continue;
+            }
+
+            // Medir tiempo de la consulta
+            auto t_query_start = chrono::high_resolution_clock::now();
+            uint64_t min_idx = motor.query(l, r);
+            auto t_query_end = chrono::high_resolution_clock::now();
+
+            auto query_ns =
+                chrono::duration_cast<chrono::nanoseconds>(t_query_end - t_query_start).count();
+
+            out.texto("Mínimo en [").sin_signo(l).texto(", ").sin_signo(r)
+               .texto("] está en índice ").sin_signo(min_idx)
+               .texto(" y vale A[").sin_signo(min_idx).texto("] = ")
+               .sin_signo(A[min_idx]).caracter('\n');
+            out.texto("Tiempo de consulta: ").entero(query_ns).texto(" ns\n");
+
+            // Guardar en CSV de consultas: size,rango,tiempo_ns
+            size_t rango = r - l + 1;
+            csv_q.sin_signo(A.size()).caracter(',').sin_signo(rango)
+                 .caracter(',').entero(query_ns).caracter('\n');
+
+        } else if (op == 'U' || op == 'u') {
+            ++p;
+            if (!dinamico) {
+                out.texto("Modo estático: no se aceptan updates (usa --modo dinamic).\n");
+                allocs.fin();
+                continue;
+            }
+            uint64_t i;
+            long long v;
+            if (!leer_sin_signo(p, fin, i) || !leer_entero(p, fin, v)) {
+                out.texto("Formato de update inválido. Usa: U i v\n");
+                allocs.fin();
+                continue;
+            }
+
+            if (i >= A.size()) {
+                out.texto("Índice fuera de límites. El arreglo tiene tamaño ")
+                   .sin_signo(A.size()).texto(" (índices 0..")
+                   .sin_signo(A.size() - 1).texto(").\n");
+                allocs.fin();
+                continue;
+            }
+            if (v < 0 || static_cast<uint64_t>(v) > valor_max) {
+                out.texto("Valor fuera de rango: A guarda enteros entre 0 y ")
+                   .sin_signo(valor_max).texto(" (ver --vmax).\n");
+                allocs.fin();
+                continue;
+            }
+
+            // Medimos el tiempo total del update: escribir en A y actualizar el motor
+            auto t_update_start = chrono::high_resolution_clock::now();
+            A[i] = static_cast<uint64_t>(v);
+            motor.update(i);
+            auto t_update_end = chrono::high_resolution_clock::now();
+            auto update_ns =
+                chrono::duration_cast<chrono::nanoseconds>(t_update_end - t_update_start).count();
+
+            out.texto("Update A[").sin_signo(i).texto("] = ").entero(v)
+               .texto(" completado. Tiempo de update: ")
+               .entero(update_ns).texto(" ns\n");
+
+            // Guardar en CSV: size,indice,valor,tiempo_ns
+            csv_u.sin_signo(A.size()).caracter(',')
+                 .sin_signo(i).caracter(',')
+                 .entero(v).caracter(',')
+                 .entero(update_ns).caracter('\n');
+
+        } else if (extras.es_comando(op)) {
+            extras.ejecutar(op, p + 1, fin);
+
+        } else {
+            out.texto("Comando no reconocido. Usa 'l r', 'Q', ")
+               .texto(dinamico ? "'U', " : "")
+               .texto("'K', 'C', 'R', 'N' o 'exit'.\n");
+        }
+        allocs.fin();
+    }
+
+    out.texto("Saliendo.\n");
+    out.vaciar();
+    csv_q.cerrar();
+    csv_u.cerrar();
+    motor.stats(cout);
+    return allocs.reporte();
+}
@@ -0,0 +1,27 @@
+// rmq_servidor.hpp
+// Loop de comandos común a todos los motores (antes copiado en cada
+// RMQ-*.cpp): construcción medida, consultas, updates y consultas extra, con
+// los mismos CSV y el mismo conteo de asignaciones para todos.
+#ifndef RMQ_SERVIDOR_HPP
+#define RMQ_SERVIDOR_HPP
+
+#include <sdsl/int_vector.hpp>
+
+#include "rmq_motor.hpp"
+
+// Construye motor sobre A y atiende comandos de stdin hasta EOF o 'exit':
+//
+//   l r  |  Q l r   -> índice del mínimo en [l, r]
+//   U i v           -> A[i] = v (solo con dinamico = true)
+//   K, C, R, N      -> consultas extra (ver comandos_extra)
+//
+// Los CSV se llaman <tipo>-rmq-<motor>-<static|dinamic>.csv:
+//   construccion  size,rmq_mb,build_ns
+//   consultas     size,range,query_ns
+//   update        size,index,value,update_ns   (solo dinámico)
+//   topk, conteo, reporte, siguiente-menor (ver comandos_extra)
+//
+// Devuelve el código de salida del programa (control_alloc::reporte()).
+int rmq_servir(motor_rmq& motor, sdsl::int_vector<>& A, bool dinamico);
+
+#endif // RMQ_SERVIDOR_HPP
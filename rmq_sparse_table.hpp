@@ -0,0 +1,77 @@
+// rmq_sparse_table.hpp
+#ifndef RMQ_SPARSE_TABLE_HPP
+#define RMQ_SPARSE_TABLE_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/bits.hpp>
+
+// Sparse Table de mínimos sobre un int_vector<> externo, con la misma
+// interfaz que rmq_support_sparse_table<> (rmq(l, r) -> índice del mínimo).
+// A diferencia de la de SDSL, los niveles se reservan una sola vez en build()
+// y rebuild() los recalcula en el mismo espacio, así que reconstruir tras un
+// update no vuelve a pedir memoria.
+struct rmq_sparse_table {
+    const sdsl::int_vector<>* A;        // puntero al arreglo original
+    std::vector<sdsl::int_vector<>> M;  // M[k][i] = índice del mínimo en [i, i + 2^(k+1) - 1]
+
+    rmq_sparse_table() : A(nullptr) {}
+
+    rmq_sparse_table(const sdsl::int_vector<>* a) {
+        build(a);
+    }
+
+    void build(const sdsl::int_vector<>* a) {
+        A = a;
+        M.clear();
+        size_t n = A->size();
+        if (n < 2) return;
+        size_t k = sdsl::bits::hi(n);  // niveles 1..k (el nivel 0 es el propio A)
+        uint8_t w = static_cast<uint8_t>(sdsl::bits::hi(n - 1) + 1);
+        M.resize(k);
+        for (size_t j = 0; j < k; ++j) {
+            M[j] = sdsl::int_vector<>(n - (2ULL << j) + 1, 0, w);
+        }
+        rebuild();
+    }
+
+    // Recalcula todos los niveles sobre el espacio ya reservado
+    void rebuild() {
+        if (M.empty()) return;
+        const sdsl::int_vector<>& a = *A;
+        sdsl::int_vector<>& m0 = M[0];
+        for (size_t i = 0; i < m0.size(); ++i) {
+            m0[i] = (a[i + 1] < a[i]) ? i + 1 : i;
+        }
+        for (size_t j = 1; j < M.size(); ++j) {
+            const sdsl::int_vector<>& prev = M[j - 1];
+            sdsl::int_vector<>& cur = M[j];
+            size_t salto = 1ULL << j;
+            for (size_t i = 0; i < cur.size(); ++i) {
+                uint64_t x = prev[i];
+                uint64_t y = prev[i + salto];
+                cur[i] = (a[y] < a[x]) ? y : x;
+            }
+        }
+    }
+
+    // Índice del mínimo en [l, r] (empate: menor índice)
+    uint64_t operator()(size_t l, size_t r) const {
+        if (l == r) return l;
+        size_t k = sdsl::bits::hi(r - l + 1);  // 2^k <= largo del rango, k >= 1
+        uint64_t x = M[k - 1][l];
+        uint64_t y = M[k - 1][r - (1ULL << k) + 1];
+        return ((*A)[y] < (*A)[x]) ? y : x;
+    }
+
+    size_t bytes() const {
+        size_t total = sizeof(*this);
+        for (size_t j = 0; j < M.size(); ++j) total += sdsl::size_in_bytes(M[j]);
+        return total;
+    }
+};
+
+#endif // RMQ_SPARSE_TABLE_HPP
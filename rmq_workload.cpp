@@ -0,0 +1,741 @@
+// rmq_workload.cpp
+// Generador y reproductor de trazas binarias de comandos RMQ.
+//
+// A diferencia de generar_comandos_rmq*.py (100 Q + 30 U uniformes en texto),
+// permite generar millones de operaciones con distribuciones más realistas
+// y reproducirlas en el mismo proceso contra cualquiera de los motores, con
+// ritmo de llegada fijo (open loop) para medir throughput y latencias de cola.
+//
+// Uso:
+//   rmq_workload gen traza.bin n ops [opciones]
+//       --updates f        fracción de updates (default 0.23, ~30 de 130)
+//       --zipf s           exponente Zipf de los puntos calientes (0 = uniforme)
+//       --rangos p,c,l,t   pesos de largo de rango: punto, corto (2..16),
+//                          log (2^U(0, log2 n)) y total [0, n-1] (default 1,1,1,1)
+//       --localidad p      prob. de caer cerca de la operación anterior (default 0)
+//       --ventana w        radio de la vecindad usada por --localidad (default 64)
+//       --vmax v           valor máximo de los updates (default 9999)
+//       --seed s           semilla (default 0)
+//   rmq_workload texto traza.bin
+//       vuelca la traza como comandos "Q l r" / "U i v" para rmq_server
+//   rmq_workload replay motor dataset traza.bin [--rate ops_por_seg] [--tlb]
+//       dataset: archivo de enteros o "aleatorio:N" (N valores en memoria)
+//       RMQ_HUGEPAGES=off|thp|hugetlb elige páginas de 2 MB para A y el árbol
+//       (hugetlb para A solo con segment-tree; el resto usa THP para A)
+//       motor: segment-tree | sparse-table | sdsl-sparse-table | adaptativo |
+//              block-sparse-table-{16,32,64} | cartesian-tree
+//       --rate 0 (default) reproduce en closed loop (latencia = servicio)
+//       --tlb  cuenta accesos y misses de dTLB solo durante la reproducción
+//              (perf_event_open; la carga de A y la construcción quedan afuera)
+//   rmq_workload verificar [--n-max N] [--casos c] [--seed s]
+//       compara todos los motores contra un scan lineal (consultas, updates y
+//       consultas extra) sobre arreglos aleatorios de tamaño 1..N, con A del
+//       ancho mínimo como en rmq_server; sale con 1 ante cualquier diferencia
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <exception>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <sdsl/int_vector.hpp>
+
+#include "rmq_motor.hpp"
+#include "rmq_arreglo.hpp"
+#include "rmq_huge_pages.hpp"
+
+using namespace std;
+using namespace sdsl;
+
+// ---- Formato de la traza ----
+
+static const char MAGIA_TRAZA[4] = {'R', 'M', 'Q', 'T'};
+static const uint32_t VERSION_TRAZA = 1;
+
+struct cabecera_traza {
+    char magia[4];
+    uint32_t version;
+    uint64_t n;      // tamaño del arreglo para el que se generó
+    uint64_t ops;    // cantidad de registros
+    uint64_t vmax;   // valor máximo que escriben los updates
+};
+
+// Q: a = l, b = r (l <= r).  U: a = i, b = v.
+struct registro_traza {
+    uint8_t op;
+    uint8_t relleno[7];
+    uint64_t a;
+    uint64_t b;
+};
+
+// ---- Zipf por rechazo-inversión (Hörmann y Derflinger) ----
+// O(1) por muestra y sin tablas, así sirve para n del orden de 10^9.
+struct zipf_rechazo {
+    double s;
+    double n;
+    double h_integral_x1;
+    double h_integral_n;
+    double corte;
+
+    zipf_rechazo(uint64_t num, double exponente) : s(exponente), n(static_cast<double>(num)) {
+        h_integral_x1 = h_integral(1.5) - 1.0;
+        h_integral_n = h_integral(n + 0.5);
+        corte = 2.0 - h_integral_inversa(h_integral(2.5) - h(2.0));
+    }
+
+    // Rango en [1, n]; el 1 es el más frecuente
+    template <class Rng>
+    uint64_t operator()(Rng& rng) {
+        uniform_real_distribution<double> U(0.0, 1.0);
+        while (true) {
+            double u = h_integral_n + U(rng) * (h_integral_x1 - h_integral_n);
+            double x = h_integral_inversa(u);
+            double k = floor(x + 0.5);
+            if (k < 1.0) k = 1.0;
+            if (k > n) k = n;
+            if (k - x <= corte || u >= h_integral(k + 0.5) - h(k)) {
+                return static_cast<uint64_t>(k);
+            }
+        }
+    }
+
+    double h(double x) const { return exp(-s * log(x)); }
+
+    double h_integral(double x) const {
+        double lx = log(x);
+        return aux2((1.0 - s) * lx) * lx;
+    }
+
+    double h_integral_inversa(double x) const {
+        double t = x * (1.0 - s);
+        if (t < -1.0) t = -1.0;
+        return exp(aux1(t) * x);
+    }
+
+    static double aux1(double x) {
+        return fabs(x) > 1e-8 ? log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+    }
+
+    static double aux2(double x) {
+        return fabs(x) > 1e-8 ? expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+    }
+};
+
+// ---- Generación ----
+
+struct opciones_gen {
+    double updates;
+    double zipf;
+    double pesos[4];  // punto, corto, log, total
+    double localidad;
+    uint64_t ventana;
+    uint64_t vmax;
+    uint64_t seed;
+
+    opciones_gen()
+        : updates(30.0 / 130.0), zipf(0.0), localidad(0.0),
+          ventana(64), vmax(9999), seed(0) {
+        pesos[0] = pesos[1] = pesos[2] = pesos[3] = 1.0;
+    }
+};
+
+static bool leer_pesos(const char* s, double* pesos) {
+    return sscanf(s, "%lf,%lf,%lf,%lf", &pesos[0], &pesos[1], &pesos[2], &pesos[3]) == 4 &&
+           pesos[0] >= 0 && pesos[1] >= 0 && pesos[2] >= 0 && pesos[3] >= 0 &&
+           pesos[0] + pesos[1] + pesos[2] + pesos[3] > 0;
+}
+
+static int generar(const char* ruta, uint64_t n, uint64_t ops, const opciones_gen& o) {
+    FILE* f = fopen(ruta, "wb");
+    if (!f) {
+        cerr << "Error: no se pudo abrir " << ruta << " para escritura.\n";
+        return 1;
+    }
+
+    cabecera_traza cab;
+    memcpy(cab.magia, MAGIA_TRAZA, 4);
+    cab.version = VERSION_TRAZA;
+    cab.n = n;
+    cab.ops = ops;
+    cab.vmax = o.vmax;
+    fwrite(&cab, sizeof(cab), 1, f);
+
+    mt19937_64 rng(o.seed);
+    uniform_real_distribution<double> U(0.0, 1.0);
+    uniform_int_distribution<uint64_t> valor(0, o.vmax);
+    uniform_int_distribution<uint64_t> corto(2, 16);
+    uniform_int_distribution<uint64_t> posicion(0, n - 1);
+    discrete_distribution<int> tipo_rango(o.pesos, o.pesos + 4);
+    zipf_rechazo zipf(n, o.zipf > 0 ? o.zipf : 1.0);
+    double log2n = log2(static_cast<double>(n));
+
+    uint64_t previo = posicion(rng);
+    vector<registro_traza> bloque;
+    bloque.reserve(4096);
+
+    for (uint64_t k = 0; k < ops; ++k) {
+        // Punto de anclaje: vecino del anterior (localidad temporal),
+        // punto caliente Zipf (dispersado por el arreglo) o uniforme
+        uint64_t ancla;
+        if (o.localidad > 0 && U(rng) < o.localidad) {
+            uint64_t w = min(o.ventana, n - 1);
+            uint64_t lo = previo >= w ? previo - w : 0;
+            uint64_t hi = min(n - 1, previo + w);
+            ancla = uniform_int_distribution<uint64_t>(lo, hi)(rng);
+        } else if (o.zipf > 0) {
+            uint64_t rango = zipf(rng) - 1;
+            ancla = (rango * 0x9E3779B97F4A7C15ULL) % n;
+        } else {
+            ancla = posicion(rng);
+        }
+        previo = ancla;
+
+        registro_traza reg;
+        memset(&reg, 0, sizeof(reg));
+        if (U(rng) < o.updates) {
+            reg.op = 'U';
+            reg.a = ancla;
+            reg.b = valor(rng);
+        } else {
+            uint64_t largo = 1;
+            switch (tipo_rango(rng)) {
+                case 0: largo = 1; break;
+                case 1: largo = corto(rng); break;
+                case 2: largo = static_cast<uint64_t>(exp2(U(rng) * log2n)); break;
+                case 3: largo = n; break;
+            }
+            if (largo < 1) largo = 1;
+            if (largo > n) largo = n;
+            uint64_t l = ancla;
+            if (l + largo > n) l = n - largo;
+            reg.op = 'Q';
+            reg.a = l;
+            reg.b = l + largo - 1;
+        }
+
+        bloque.push_back(reg);
+        if (bloque.size() == bloque.capacity()) {
+            fwrite(bloque.data(), sizeof(registro_traza), bloque.size(), f);
+            bloque.clear();
+        }
+    }
+    if (!bloque.empty()) {
+        fwrite(bloque.data(), sizeof(registro_traza), bloque.size(), f);
+    }
+
+    if (fclose(f) != 0) {
+        cerr << "Error: falló la escritura de " << ruta << ".\n";
+        return 1;
+    }
+    cout << "Traza '" << ruta << "' creada: n=" << n << ", " << ops << " operaciones.\n";
+    return 0;
+}
+
+// Un registro es válido si no lee ni escribe fuera de A[0, n) ni escribe un
+// valor mayor a vmax (el ancho de A se elige según vmax)
+static bool registro_valido(const registro_traza& reg, const cabecera_traza& cab) {
+    if (reg.op == 'Q') return reg.a <= reg.b && reg.b < cab.n;
+    if (reg.op == 'U') return reg.a < cab.n && reg.b <= cab.vmax;
+    return false;
+}
+
+// Lee la traza y valida cada registro contra la cabecera, así una traza
+// truncada o editada a mano se rechaza antes de reproducirla
+static bool cargar_traza(const char* ruta, cabecera_traza& cab, vector<registro_traza>& regs) {
+    FILE* f = fopen(ruta, "rb");
+    if (!f) {
+        cerr << "Error: no se pudo abrir la traza " << ruta << "\n";
+        return false;
+    }
+    bool ok = fread(&cab, sizeof(cab), 1, f) == 1 &&
+              memcmp(cab.magia, MAGIA_TRAZA, 4) == 0 &&
+              cab.version == VERSION_TRAZA;
+    if (!ok) {
+        cerr << "Error: " << ruta << " no es una traza RMQ válida.\n";
+        fclose(f);
+        return false;
+    }
+    // Tamaño real antes de reservar: ops no puede exceder lo que hay en el archivo
+    long inicio = ftell(f);
+    fseek(f, 0, SEEK_END);
+    uint64_t disponibles = static_cast<uint64_t>(ftell(f) - inicio) / sizeof(registro_traza);
+    fseek(f, inicio, SEEK_SET);
+    if (cab.ops > disponibles) {
+        cerr << "Error: la traza " << ruta << " está truncada.\n";
+        fclose(f);
+        return false;
+    }
+    regs.resize(cab.ops);
+    if (fread(regs.data(), sizeof(registro_traza), regs.size(), f) != regs.size()) {
+        cerr << "Error: la traza " << ruta << " está truncada.\n";
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+    for (size_t k = 0; k < regs.size(); ++k) {
+        if (!registro_valido(regs[k], cab)) {
+            cerr << "Error: el registro " << k << " de " << ruta << " está fuera de rango "
+                 << "(n=" << cab.n << ", vmax=" << cab.vmax << ").\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+static int volcar_texto(const char* ruta) {
+    cabecera_traza cab;
+    vector<registro_traza> regs;
+    if (!cargar_traza(ruta, cab, regs)) return 1;
+    for (size_t k = 0; k < regs.size(); ++k) {
+        printf("%c %llu %llu\n", regs[k].op,
+               static_cast<unsigned long long>(regs[k].a),
+               static_cast<unsigned long long>(regs[k].b));
+    }
+    return 0;
+}
+
+// ---- Reproducción ----
+
+struct resumen_lat {
+    size_t cantidad;
+    uint64_t p50, p90, p99, p999, max;
+};
+
+static uint64_t percentil(const vector<uint64_t>& ordenado, double p) {
+    size_t k = static_cast<size_t>(ceil(p * ordenado.size()));
+    if (k > 0) --k;
+    return ordenado[min(k, ordenado.size() - 1)];
+}
+
+static resumen_lat resumir(vector<uint64_t>& lat) {
+    resumen_lat r;
+    memset(&r, 0, sizeof(r));
+    r.cantidad = lat.size();
+    if (lat.empty()) return r;
+    sort(lat.begin(), lat.end());
+    r.p50 = percentil(lat, 0.50);
+    r.p90 = percentil(lat, 0.90);
+    r.p99 = percentil(lat, 0.99);
+    r.p999 = percentil(lat, 0.999);
+    r.max = lat.back();
+    return r;
+}
+
+// ---- Contadores de dTLB ----
+// Contadores de hardware abiertos en el propio proceso, para medir solo el
+// loop de reproducción: con perf stat sobre todo el proceso, a n ~ 10^9 la
+// generación de A y la construcción del árbol tapan los misses del replay.
+
+struct contadores_tlb {
+    int fd_accesos;
+    int fd_misses;
+
+    contadores_tlb() : fd_accesos(-1), fd_misses(-1) {}
+    ~contadores_tlb() {
+        if (fd_accesos >= 0) close(fd_accesos);
+        if (fd_misses >= 0) close(fd_misses);
+    }
+
+    static int abrir_uno(uint64_t resultado) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (resultado << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    // Si el kernel o los permisos (perf_event_paranoid) no lo permiten,
+    // avisa y la reproducción sigue sin contadores
+    bool abrir() {
+        fd_accesos = abrir_uno(PERF_COUNT_HW_CACHE_RESULT_ACCESS);
+        fd_misses = abrir_uno(PERF_COUNT_HW_CACHE_RESULT_MISS);
+        if (fd_accesos < 0 || fd_misses < 0) {
+            cerr << "Advertencia: no se pudieron abrir los contadores de dTLB ("
+                 << strerror(errno) << "): sin soporte de perf en esta máquina o "
+                 << "kernel.perf_event_paranoid demasiado alto.\n";
+            return false;
+        }
+        return true;
+    }
+
+    void control(unsigned long op) {
+        if (fd_accesos < 0 || fd_misses < 0) return;
+        ioctl(fd_accesos, op, 0);
+        ioctl(fd_misses, op, 0);
+    }
+
+    void iniciar() {
+        control(PERF_EVENT_IOC_RESET);
+        control(PERF_EVENT_IOC_ENABLE);
+    }
+    void detener() { control(PERF_EVENT_IOC_DISABLE); }
+
+    static uint64_t leer(int fd) {
+        uint64_t v = 0;
+        if (fd < 0 || read(fd, &v, sizeof(v)) != static_cast<ssize_t>(sizeof(v))) return 0;
+        return v;
+    }
+
+    void mostrar(ostream& out) const {
+        if (fd_accesos < 0 || fd_misses < 0) return;
+        uint64_t accesos = leer(fd_accesos), misses = leer(fd_misses);
+        out << "dTLB (solo reproducción): " << accesos << " loads, " << misses << " misses";
+        if (accesos > 0) out << " (" << 100.0 * misses / accesos << " %)";
+        out << "\n";
+    }
+};
+
+static int reproducir(motor_rmq& motor, int_vector<>& A,
+                      const vector<registro_traza>& regs, double rate, bool tlb) {
+    const char* nombre = motor.nombre();
+    auto t_build_start = chrono::steady_clock::now();
+    try {
+        motor.build(&A);
+    } catch (const exception& e) {
+        cerr << "Error: no se pudo construir el RMQ (" << e.what() << ").\n";
+        return 1;
+    }
+    auto t_build_end = chrono::steady_clock::now();
+    auto build_ns =
+        chrono::duration_cast<chrono::nanoseconds>(t_build_end - t_build_start).count();
+
+    vector<uint64_t> lat_q, lat_u;
+    lat_q.reserve(regs.size());
+    lat_u.reserve(regs.size());
+
+    // Open loop: la operación k "llega" en t0 + k / rate aunque el motor vaya
+    // atrasado, así la latencia incluye la cola (sin omisión coordinada).
+    const double periodo_ns = rate > 0 ? 1e9 / rate : 0.0;
+    uint64_t checksum = 0;
+
+    contadores_tlb contadores;
+    if (tlb && contadores.abrir()) contadores.iniciar();
+
+    auto t0 = chrono::steady_clock::now();
+    for (size_t k = 0; k < regs.size(); ++k) {
+        const registro_traza& reg = regs[k];
+        chrono::steady_clock::time_point llegada;
+        if (rate > 0) {
+            llegada = t0 + chrono::nanoseconds(static_cast<int64_t>(k * periodo_ns));
+            while (chrono::steady_clock::now() < llegada) {
+                // espera activa hasta la llegada programada
+            }
+        } else {
+            llegada = chrono::steady_clock::now();
+        }
+
+        if (reg.op == 'Q') {
+            checksum += motor.query(reg.a, reg.b);
+        } else {
+            A[reg.a] = reg.b;
+            motor.update(reg.a);
+        }
+
+        auto t_fin = chrono::steady_clock::now();
+        uint64_t ns = chrono::duration_cast<chrono::nanoseconds>(t_fin - llegada).count();
+        (reg.op == 'Q' ? lat_q : lat_u).push_back(ns);
+    }
+    auto t_total_end = chrono::steady_clock::now();
+    contadores.detener();
+
+    double total_s = chrono::duration<double>(t_total_end - t0).count();
+    double throughput = total_s > 0 ? regs.size() / total_s : 0.0;
+
+    vector<uint64_t> lat_todas(lat_q);
+    lat_todas.insert(lat_todas.end(), lat_u.begin(), lat_u.end());
+    resumen_lat r[3] = {resumir(lat_todas), resumir(lat_q), resumir(lat_u)};
+    const char* tipos[3] = {"all", "Q", "U"};
+
+    cout << "Motor " << nombre << ": n=" << A.size() << ", " << regs.size()
+         << " operaciones, construcción " << build_ns << " ns, "
+         << motor.bytes() << " bytes\n";
+    cout << "Ritmo objetivo: " << (rate > 0 ? to_string(rate) + " ops/s" : string("closed loop"))
+         << ", throughput " << throughput << " ops/s (checksum " << checksum << ")\n";
+    for (int t = 0; t < 3; ++t) {
+        cout << "  " << tipos[t] << ": " << r[t].cantidad << " ops, p50 " << r[t].p50
+             << " ns, p90 " << r[t].p90 << " ns, p99 " << r[t].p99
+             << " ns, p99.9 " << r[t].p999 << " ns, max " << r[t].max << " ns\n";
+    }
+    contadores.mostrar(cout);
+    motor.stats(cout);
+
+    // CSV: motor,size,ops,rate,tipo,cantidad,throughput,p50_ns,p90_ns,p99_ns,p999_ns,max_ns
+    ofstream csv("workload-rmq.csv", ios::app);
+    if (!csv) {
+        cerr << "Advertencia: no se pudo abrir workload-rmq.csv para escritura.\n";
+    } else {
+        for (int t = 0; t < 3; ++t) {
+            csv << nombre << "," << A.size() << "," << regs.size() << "," << rate << ","
+                << tipos[t] << "," << r[t].cantidad << "," << throughput << ","
+                << r[t].p50 << "," << r[t].p90 << "," << r[t].p99 << ","
+                << r[t].p999 << "," << r[t].max << "\n";
+        }
+    }
+    return 0;
+}
+
+static int replay(const char* motor, const char* dataset, const char* traza, double rate,
+                  bool tlb) {
+    cabecera_traza cab;
+    vector<registro_traza> regs;
+    if (!cargar_traza(traza, cab, regs)) return 1;
+
+    // El motor se crea antes que A: decide si A puede ir al pool hugetlb
+    motor_rmq* m = crear_motor(motor);
+    if (m == nullptr) {
+        cerr << "Error: motor desconocido '" << motor << "'. Opciones:\n"
+             << nombres_motores() << "\n";
+        return 1;
+    }
+
+    int_vector<> A;
+    if (!rmq_cargar_arreglo(dataset, cab.vmax, A, !m->crea_int_vectors())) {
+        delete m;
+        return 1;
+    }
+    if (A.size() != cab.n) {
+        cerr << "Error: la traza fue generada para n=" << cab.n
+             << " pero el dataset tiene " << A.size() << " elementos.\n";
+        delete m;
+        return 1;
+    }
+
+    cout << "Páginas: " << rmq_nombre_modo_paginas(rmq_modo_paginas_actual()) << "\n";
+
+    int codigo = reproducir(*m, A, regs, rate, tlb);
+    delete m;
+    return codigo;
+}
+
+// ---- Verificación contra fuerza bruta ----
+
+static uint64_t min_lineal(const int_vector<>& A, size_t l, size_t r) {
+    uint64_t m = l;
+    for (size_t i = l + 1; i <= r; ++i) {
+        if (A[i] < A[m]) m = i;
+    }
+    return m;
+}
+
+// Cuenta diferencias del motor contra el scan lineal sobre A (que modifica
+// con updates); imprime las primeras
+static size_t verificar_motor(motor_rmq& motor, int_vector<>& A, uint64_t vmax,
+                              mt19937_64& rng, size_t& reportadas) {
+    size_t n = A.size();
+    size_t errores = 0;
+    vector<nodo_top_k> heap;
+    vector<uint64_t> salida(n);
+    motor.build(&A);
+
+    for (size_t op = 0; op < 8 * n + 16; ++op) {
+        size_t l = rng() % n, r = rng() % n;
+        if (l > r) swap(l, r);
+        int tipo = static_cast<int>(rng() % 8);
+        bool mal = false;
+
+        if (tipo == 0) {
+            size_t i = rng() % n;
+            A[i] = rng() % (vmax + 1);
+            motor.update(i);
+            continue;
+        } else if (tipo <= 4) {
+            mal = motor.query(l, r) != min_lineal(A, l, r);
+        } else if (tipo == 5) {
+            // top-k: los k menores en orden (valor, índice)
+            size_t k = rng() % (r - l + 2);
+            size_t c = motor.top_k(l, r, k, heap, salida.data());
+            vector<uint64_t> esperado;
+            for (size_t i = l; i <= r; ++i) esperado.push_back(i);
+            stable_sort(esperado.begin(), esperado.end(),
+                        [&](uint64_t a, uint64_t b) { return A[a] < A[b]; });
+            esperado.resize(k);
+            mal = c != k || !equal(esperado.begin(), esperado.end(), salida.begin());
+        } else if (tipo == 6) {
+            uint64_t t = rng() % (vmax + 2);
+            contador_menores f;
+            motor.reportar_menores(l, r, t, f);
+            uint64_t esperado = 0;
+            for (size_t i = l; i <= r; ++i) esperado += A[i] < t;
+            mal = f.cantidad != esperado;
+        } else {
+            uint64_t j = motor.siguiente_menor(l);
+            uint64_t esperado = RMQ_NINGUNO;
+            for (size_t i = l + 1; i < n; ++i) {
+                if (A[i] < A[l]) {
+                    esperado = i;
+                    break;
+                }
+            }
+            mal = j != esperado;
+        }
+
+        if (mal) {
+            ++errores;
+            if (reportadas < 10) {
+                ++reportadas;
+                cerr << "  " << motor.nombre() << ": n=" << n << " op " << "QQQQQKCN"[tipo]
+                     << " l=" << l << " r=" << r << " difiere del scan lineal\n";
+            }
+        }
+    }
+    return errores;
+}
+
+static int verificar(size_t n_max, size_t casos, uint64_t seed) {
+    mt19937_64 rng(seed);
+    size_t total = 0;
+    size_t reportadas = 0;
+    for (size_t k = 0; nombre_motor(k) != nullptr; ++k) {
+        size_t errores = 0;
+        for (size_t caso = 0; caso < casos; ++caso) {
+            size_t n = 1 + rng() % n_max;
+            // Rangos de valores chicos (muchos empates) a grandes, y a veces
+            // ordenado o invertido (árboles cartesianos degenerados)
+            static const uint64_t VMAX[] = {1, 3, 50, 9999, (1ULL << 40)};
+            uint64_t vmax = VMAX[rng() % 5];
+            int_vector<> A(n, 0, static_cast<uint8_t>(bits::hi(vmax) + 1));
+            for (size_t i = 0; i < n; ++i) A[i] = rng() % (vmax + 1);
+            int forma = static_cast<int>(rng() % 4);
+            if (forma == 1) {
+                for (size_t i = 0; i < n; ++i) A[i] = (i * vmax) / n;
+            } else if (forma == 2) {
+                for (size_t i = 0; i < n; ++i) A[i] = ((n - 1 - i) * vmax) / n;
+            }
+
+            motor_rmq* motor = crear_motor(nombre_motor(k));
+            errores += verificar_motor(*motor, A, vmax, rng, reportadas);
+            delete motor;
+        }
+        cout << nombre_motor(k) << ": " << casos << " arreglos, "
+             << (errores == 0 ? string("OK") : to_string(errores) + " diferencias") << "\n";
+        total += errores;
+    }
+    return total == 0 ? 0 : 1;
+}
+
+static void uso(const char* prog) {
+    cerr << "Uso:\n"
+         << "  " << prog << " gen traza.bin n ops [--updates f] [--zipf s] [--rangos p,c,l,t]\n"
+         << "      [--localidad p] [--ventana w] [--vmax v] [--seed s]\n"
+         << "  " << prog << " texto traza.bin\n"
+         << "  " << prog << " replay motor dataset|aleatorio:N traza.bin [--rate ops_por_seg] [--tlb]\n"
+         << "      motor:\n" << nombres_motores() << "\n"
+         << "  " << prog << " verificar [--n-max N] [--casos c] [--seed s]\n";
+}
+
+int main(int argc, char* argv[]) {
+    string cmd(argc > 1 ? argv[1] : "");
+    if (argc < 3 && cmd != "verificar") {
+        uso(argv[0]);
+        return 1;
+    }
+
+    if (cmd == "gen") {
+        if (argc < 5) {
+            uso(argv[0]);
+            return 1;
+        }
+        uint64_t n = strtoull(argv[3], nullptr, 10);
+        uint64_t ops = strtoull(argv[4], nullptr, 10);
+        if (n == 0) {
+            cerr << "Error: n debe ser positivo.\n";
+            return 1;
+        }
+        opciones_gen o;
+        for (int k = 5; k < argc; ++k) {
+            string opt(argv[k]);
+            if (k + 1 >= argc) {
+                cerr << "Error: falta el valor de " << opt << "\n";
+                return 1;
+            }
+            const char* v = argv[++k];
+            if (opt == "--updates") o.updates = atof(v);
+            else if (opt == "--zipf") o.zipf = atof(v);
+            else if (opt == "--localidad") o.localidad = atof(v);
+            else if (opt == "--ventana") o.ventana = strtoull(v, nullptr, 10);
+            else if (opt == "--vmax") o.vmax = strtoull(v, nullptr, 10);
+            else if (opt == "--seed") o.seed = strtoull(v, nullptr, 10);
+            else if (opt == "--rangos") {
+                if (!leer_pesos(v, o.pesos)) {
+                    cerr << "Error: --rangos espera 4 pesos no negativos, p.ej. 1,1,1,1\n";
+                    return 1;
+                }
+            } else {
+                cerr << "Error: opción desconocida " << opt << "\n";
+                return 1;
+            }
+        }
+        return generar(argv[2], n, ops, o);
+    }
+
+    if (cmd == "verificar") {
+        size_t n_max = 300, casos = 200;
+        uint64_t seed = 0;
+        for (int k = 2; k < argc; ++k) {
+            string opt(argv[k]);
+            if (k + 1 >= argc) {
+                cerr << "Error: falta el valor de " << opt << "\n";
+                return 1;
+            }
+            const char* v = argv[++k];
+            if (opt == "--n-max") n_max = strtoull(v, nullptr, 10);
+            else if (opt == "--casos") casos = strtoull(v, nullptr, 10);
+            else if (opt == "--seed") seed = strtoull(v, nullptr, 10);
+            else {
+                cerr << "Error: opción desconocida " << opt << "\n";
+                return 1;
+            }
+        }
+        if (n_max == 0) {
+            cerr << "Error: --n-max debe ser positivo.\n";
+            return 1;
+        }
+        return verificar(n_max, casos, seed);
+    }
+
+    if (cmd == "texto") {
+        return volcar_texto(argv[2]);
+    }
+
+    if (cmd == "replay") {
+        if (argc < 5) {
+            uso(argv[0]);
+            return 1;
+        }
+        double rate = 0.0;
+        bool tlb = false;
+        for (int k = 5; k < argc; ++k) {
+            string opt(argv[k]);
+            if (opt == "--rate" && k + 1 < argc) {
+                rate = atof(argv[++k]);
+            } else if (opt == "--tlb") {
+                tlb = true;
+            } else {
+                cerr << "Error: opción desconocida " << opt << "\n";
+                return 1;
+            }
+        }
+        return replay(argv[2], argv[3], argv[4], rate, tlb);
+    }
+
+    uso(argv[0]);
+    return 1;
+}
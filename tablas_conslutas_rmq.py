@@ -5,10 +5,10 @@ from statistics import mean, stdev
 
 # Archivos de entrada
 FILES = {
-    "ST-Static":  "consultas-rmq-sparse-table-static.csv",
-    "ST-Dynamic": "consultas-rmq-sparse-table.csv",
+    "ST-Static":  "consultas-rmq-sdsl-sparse-table-static.csv",
+    "ST-Dynamic": "consultas-rmq-sparse-table-dinamic.csv",
     "Seg-Static": "consultas-rmq-segment-tree-static.csv",
-    "Seg-Dynamic":"consultas-rmq-segment-tree.csv",
+    "Seg-Dynamic":"consultas-rmq-segment-tree-dinamic.csv",
 }
 
 # ---------- Lectura y resumen de datos ----------